@@ -130,6 +130,13 @@ static struct sigaction _old_signal_handler_SIGTERM;  // 15
 //    double S,W,N,E;
 //} _extent;
 
+// light sector - position and screen independent reach, see _indexLights()
+typedef struct _lightSec {
+    S52_obj *obj;
+    double   x, y;        // PRJ position of the light
+    double   r;           // PRJ nominal range (VALNMR) - reach of legs in full sector mode
+} _lightSec;
+
 typedef struct _cell {
     extent    geoExt;     // cell geo extent
 
@@ -139,6 +146,8 @@ typedef struct _cell {
     GPtrArray *renderBin[S52_PRIO_NUM][S52_N_OBJ];//[RAD_NUM];
 
     GPtrArray *lights_sector;   // see _doCullLights
+    GArray    *lights_idx;      // _lightSec sorted by x (PRJ) - spatial index of lights_sector
+    double     lights_rmax;     // max _lightSec.r of this cell
 
     localObj  *local;         // reference to object locality for CS
 
@@ -195,17 +204,10 @@ typedef struct _cell {
     int        projDone;       // TRUE this cell has been projected
 #endif
 
-    /*
     // optimisation - do CS only on obj affected by a change in a MP
-    // instead of resolving the CS logic at render-time.
-    // Will help to clean up the render-time code.
-    // list of S52_obj that have CS in theire LUP
-    GPtrArray *DEPARElist;
-    GPtrArray *DEPCNTlist;
-    GPtrArray *OBSTRNlist;
-    GPtrArray *RESARElist;
-    GPtrArray *WRECKSlist;
-    */
+    // registry: S52_obj in renderBin whose CS read this Mariner's Param (see _csDepBuild())
+    // Note: not used by the mariner cell (obj come and go) - see _resolveCSdep()
+    GPtrArray *csDep[S52_MAR_NUM];
 
 } _cell;
 
@@ -215,6 +217,44 @@ static GTree     *_lnamBBT      = NULL;
 static GPtrArray *_cellList     = NULL;    // list of loaded cells - sorted, big to small scale (small to large region)
 static _cell     *_crntCell     = NULL;    // current cell (passed around when loading --FIXME: global var (dumb))
 static _cell     *_marinerCell  = NULL;    // place holder MIO's, and other (fake) S57 object
+static GPtrArray *_dcltList     = NULL;    // declutter - obj of all cells sorted by display priority
+
+// journal sort - GL state key of a run of obj of the same display priority and type
+typedef struct _jrnlKey {
+    S52_obj *obj;
+    guint64  state;     // GL pipeline state (S52_GL_getStateKey())
+    guint    idx;       // position in journal (keep order of equal state)
+} _jrnlKey;
+static GArray    *_jrnlSort     = NULL;
+
+// cull task - cull the obj of one visible cell, ie fill the journal of that cell
+// Note: with S52_MAR_DISP_CULL_THREAD the tasks run in a thread pool, GL call stay in the main thread
+typedef struct _cullTask {
+    _cell   *c;
+    guint    nTotal;    // statistic
+    guint    nCull;
+    guint    nClip;     // summed after the join - no shared counter between worker
+} _cullTask;
+static GArray      *_cullTaskList = NULL;
+static GThreadPool *_cullPool     = NULL;
+static GAsyncQueue *_cullDone     = NULL;  // task pushed back by the worker when done
+// mariner obj are in every cell journal, culled once (main thread) then merged by each task
+static GPtrArray   *_marVis[S52_PRIO_MARINR][S52_N_OBJ];  // mariner obj not culled
+static GPtrArray   *_marTxt[S52_PRIO_MARINR][S52_N_OBJ];  // mariner obj not culled that have text
+
+// CS task - resolve the CS of the obj of one cell (see _app())
+// Note: with S52_MAR_CS_THREAD the tasks run in a thread pool, a CS only touch obj of its own cell
+// (touch link are per cell - S52_CS_touch())
+typedef struct _csTask {
+    _cell   *c;
+    guint64  changed;   // 0 - all CS, else S52_MP_BIT() of the Mariner's Param that changed
+    guint    nObj;      // statistic - nbr of obj resolved
+} _csTask;
+static GThreadPool *_csPool       = NULL;
+static GAsyncQueue *_csDone       = NULL;  // task pushed back by the worker when done
+#define TILE_PX        256                // XYZ tile size (pixel)
+#define TILE_ZOOM_MAX   19                // z20+ tile range fall bellow MIN_RANGE (equator)
+#define TILE_DIR       "tiles"            // default tile disk cache (see CFG_TILE in s52.cfg)
 #define MARINER_CELL   "--6MARIN.000"     // a chart purpose 6 (bellow knowm IHO chart purpose)
 #define WORLD_SHP_EXT  ".shp"             // shapefile ext
 #define WORLD_BASENM   "--0WORLD"         // '--' - agency (none), 0 - chart purpose (S52 is 1-5 (harbour))
@@ -230,6 +270,7 @@ static int        _doInit       = TRUE;    // init the lib
 
 // FIXME: reparse CS of the affected MP only (ex: ship outline MP need only to reparse OWNSHP CS)
 static int        _doCS         = FALSE;   // TRUE will recreate *all* CS at next draw() or drawLast()
+static guint64    _doCSdep      = 0;       // S52_MP_BIT() of Mariner's Param changed, recreate CS that depend on them
 static int        _doDATCVR     = FALSE;   // TRUE will compute HO Data Limit (CSP union), scale boundary, ..
 
 static int        _doCullLights = FALSE;   // TRUE will do lights_sector culling when _cellList change
@@ -239,6 +280,7 @@ static char      *_intl         = NULL;    // setlocal()
 // statistic
 static guint      _nCull        = 0;
 static guint      _nTotal       = 0;
+static guint      _nClip        = 0;       // culled by S52_GL_isSupp() / S52_GL_isOFFview()
 
 // helper - save user center of view in degree
 typedef struct {
@@ -591,23 +633,23 @@ DLL int    STD S52_setMarinerParam(S52MarinerParameter paramID, double val)
         case S52_MAR_ERROR               : break;
         case S52_MAR_SHOW_TEXT           : val = _validate_bool(val);                   break;
         // _SEABED01->DEPARE01;
-        case S52_MAR_TWO_SHADES          : val = _validate_bool(val);  _doCS = TRUE;    break;
+        case S52_MAR_TWO_SHADES          : val = _validate_bool(val);  _doCSdep |= S52_MP_BIT(paramID); break;
         // DEPCNT02; _SEABED01->DEPARE01; _UDWHAZ03->OBSTRN04, WRECKS02;
-        case S52_MAR_SAFETY_CONTOUR      : val = _validate_meter(val); _doCS = TRUE;    break;
+        case S52_MAR_SAFETY_CONTOUR      : val = _validate_meter(val); _doCSdep |= S52_MP_BIT(paramID); break;
         // _SNDFRM02->OBSTRN04, WRECKS02;
-        case S52_MAR_SAFETY_DEPTH        : val = _validate_meter(val); _doCS = TRUE;    break;
+        case S52_MAR_SAFETY_DEPTH        : val = _validate_meter(val); _doCSdep |= S52_MP_BIT(paramID); break;
         // _SEABED01->DEPARE01;
-        case S52_MAR_SHALLOW_CONTOUR     : val = _validate_meter(val); _doCS = TRUE;    break;
+        case S52_MAR_SHALLOW_CONTOUR     : val = _validate_meter(val); _doCSdep |= S52_MP_BIT(paramID); break;
         // _SEABED01->DEPARE01;
-        case S52_MAR_DEEP_CONTOUR        : val = _validate_meter(val); _doCS = TRUE;    break;
+        case S52_MAR_DEEP_CONTOUR        : val = _validate_meter(val); _doCSdep |= S52_MP_BIT(paramID); break;
         // _SEABED01->DEPARE01;
-        case S52_MAR_SHALLOW_PATTERN     : val = _validate_bool(val);  _doCS = TRUE;    break;
+        case S52_MAR_SHALLOW_PATTERN     : val = _validate_bool(val);  _doCSdep |= S52_MP_BIT(paramID); break;
         case S52_MAR_SHIPS_OUTLINE       : val = _validate_bool(val);                   break;
         case S52_MAR_DISTANCE_TAGS       : val = _validate_nm(val);    _fixme(paramID); break;
         case S52_MAR_TIME_TAGS           : val = _validate_min(val);   _fixme(paramID); break;
         case S52_MAR_FULL_SECTORS        : val = _validate_bool(val);                   break;
         // RESARE02;
-        case S52_MAR_SYMBOLIZED_BND      : val = _validate_bool(val);  _doCS = TRUE;    break;
+        case S52_MAR_SYMBOLIZED_BND      : val = _validate_bool(val);  _doCSdep |= S52_MP_BIT(paramID); break;
         case S52_MAR_SYMPLIFIED_PNT      : val = _validate_bool(val);                   break;
         case S52_MAR_DISP_CATEGORY       : val = _validate_disp(val);                   break;
         case S52_MAR_COLOR_PALETTE       : val = _validate_pal(val);                    break;
@@ -629,7 +671,7 @@ DLL int    STD S52_setMarinerParam(S52MarinerParameter paramID, double val)
         //
         case S52_MAR_FONT_SOUNDG         : val = _fixme(val);                           break;
         // DEPARE01; DEPCNT02; _DEPVAL01; SLCONS03; _UDWHAZ03;
-        case S52_MAR_DATUM_OFFSET        : val = _validate_meter(val); _doCS = TRUE;    break;
+        case S52_MAR_DATUM_OFFSET        : val = _validate_meter(val); _doCSdep |= S52_MP_BIT(paramID); break;
         case S52_MAR_SCAMIN              : val = _validate_bool(val);                   break;
         case S52_MAR_ANTIALIAS           : val = _validate_bool(val);                   break;
         case S52_MAR_QUAPNT01            : val = _validate_bool(val);                   break;
@@ -660,6 +702,12 @@ DLL int    STD S52_setMarinerParam(S52MarinerParameter paramID, double val)
         case S52_MAR_GUARDZONE_ALARM     : val = _validate_positive(val);               break;
 
     	case S52_MAR_DISP_HODATA         : val = _validate_positive(val);               break;
+        case S52_MAR_DISP_DECLUTTER      : val = _validate_int(val);                    break;
+        case S52_MAR_DISP_TILE_CACHE     : val = _validate_positive(val);               break;
+        case S52_MAR_DISP_STATE_SORT     : val = _validate_bool(val);                   break;
+        case S52_MAR_DISP_CULL_THREAD    : val = _validate_positive(val);               break;
+        case S52_MAR_DISP_DIRTY_RECT     : val = _validate_bool(val);                   break;
+        case S52_MAR_CS_THREAD           : val = _validate_positive(val);               break;
 
         default:
             PRINTF("WARNING: unknown Mariner's Parameter type (%i)\n", paramID);
@@ -671,6 +719,13 @@ DLL int    STD S52_setMarinerParam(S52MarinerParameter paramID, double val)
 
     int ret = S52_MP_set(paramID, val);
 
+    // display category changed - rebuild the toggle state table used by the cull
+    if (S52_MAR_DISP_CATEGORY==paramID || S52_MAR_DISP_LAYER_LAST==paramID)
+        S52_PL_resetToggle();
+
+    // drawLast() - restore all the view
+    S52_GL_setDirty(NULL);
+
     ///////////////////////////////////////////////
     // FIXME: process _doCS == TRUE immediatly
     //
@@ -717,6 +772,9 @@ DLL int    STD S52_setMarinerParam(S52MarinerParameter paramID, double val)
     // OWNSHP02; MP
     // VESSEL01; MP
 
+    // any MP can change what is drawn - redo placement
+    S52_GL_resetDeclutter();
+
     GMUTEXUNLOCK(&_mp_mutex);
 
     return ret;
@@ -730,6 +788,9 @@ DLL int    STD S52_setTextDisp(unsigned int prioIdx, unsigned int count, unsigne
 
     int ret = S52_MP_setTextDisp(prioIdx, count, state);
 
+    S52_GL_resetDeclutter();
+    S52_GL_resetTileCache();
+
     GMUTEXUNLOCK(&_mp_mutex);
 
     return ret;
@@ -877,6 +938,10 @@ static int        _freeCell(_cell *c)
         }
         g_ptr_array_free(c->lights_sector, TRUE);
     }
+    if (NULL != c->lights_idx) {
+        g_array_free(c->lights_idx, TRUE);
+        c->lights_idx = NULL;
+    }
 
     if (NULL != c->textList) {
         g_ptr_array_free(c->textList, TRUE);
@@ -893,28 +958,12 @@ static int        _freeCell(_cell *c)
         c->objList_over = NULL;
     }
 
-    /*
-    if (NULL != cell->DEPARElist) {
-        g_ptr_array_free(c->objList_over, TRUE);
-        cell->DEPARElist = NULL;
-    }
-    if (NULL != cell->DEPCNTlist) {
-        g_ptr_array_free(c->objList_over, TRUE);
-        cell->DEPCNTlist = NULL;
-    }
-    if (NULL != cell->OBSTRNlist) {
-        g_ptr_array_free(c->objList_over, TRUE);
-        cell->OBSTRNlist = NULL;
-    }
-    if (NULL != cell->RESARElist) {
-        g_ptr_array_free(c->objList_over, TRUE);
-        cell->RESARElist = NULL;
-    }
-    if (NULL != cell->WRECKSlist) {
-        g_ptr_array_free(c->objList_over, TRUE);
-        cell->WRECKSlist = NULL;
+    for (int p=0; p<S52_MAR_NUM; ++p) {
+        if (NULL != c->csDep[p]) {
+            g_ptr_array_free(c->csDep[p], TRUE);
+            c->csDep[p] = NULL;
+        }
     }
-    */
 
     if (NULL != c->S57ClassList) {
         g_string_free(c->S57ClassList, TRUE);
@@ -1382,6 +1431,56 @@ static int        _initPROJview(void)
     return TRUE;
 }
 
+static gint       _cmpLightSec(gconstpointer a, gconstpointer b)
+{
+    const _lightSec *la = (const _lightSec *)a;
+    const _lightSec *lb = (const _lightSec *)b;
+
+    return (la->x < lb->x) ? -1 : (la->x > lb->x) ? 1 : 0;
+}
+
+static int        _indexLights(_cell *c)
+// index lights sector on PRJ x with there nominal range (call after lights are projected)
+{
+    if (NULL == c->lights_idx)
+        c->lights_idx = g_array_new(FALSE, FALSE, sizeof(_lightSec));
+    g_array_set_size(c->lights_idx, 0);
+    c->lights_rmax = 0.0;
+
+    for (guint i=0; i<c->lights_sector->len; ++i) {
+        S52_obj  *obj = (S52_obj *)g_ptr_array_index(c->lights_sector, i);
+        S57_geo  *geo = S52_PL_getGeo(obj);
+        guint     npt = 0;
+        double   *ppt = NULL;
+        _lightSec ls  = {obj, 0.0, 0.0, 0.0};
+
+        if ((FALSE==S57_getGeoData(geo, 0, &npt, &ppt)) || (0 == npt))
+            continue;
+
+        ls.x = ppt[0];
+        ls.y = ppt[1];
+
+        // nominal range - same as _renderLS_LIGHTS05() in full sector mode
+        GString *valnmrstr = S57_getAttVal(geo, "VALNMR");
+        if (NULL != valnmrstr) {
+            double x1, y1, x2, y2;
+            S57_getExt(geo, &x1, &y1, &x2, &y2);
+
+            double xyz[6] = {x1, y1, 0.0, x1, y1 + (S52_atof(valnmrstr->str) / 60.0), 0.0};
+            if (TRUE == S57_geo2prj3dv(2, xyz))
+                ls.r = fabs(xyz[4] - xyz[1]);
+        }
+
+        c->lights_rmax = MAX(c->lights_rmax, ls.r);
+
+        g_array_append_val(c->lights_idx, ls);
+    }
+
+    g_array_sort(c->lights_idx, _cmpLightSec);
+
+    return TRUE;
+}
+
 static int        _projectCells(void)
 {
 #ifdef S52_USE_PROJ
@@ -1395,6 +1494,14 @@ static int        _projectCells(void)
                         S52_obj *obj  = (S52_obj *)g_ptr_array_index(rbin, idx);
                         S57_geo *geo  = S52_PL_getGeo(obj);
                         S57_geo2prj(geo);
+
+                        // simplified LINES / AREAS for small scale (mariner's obj change all the time)
+                        // and pole of AREAS for centered symbol / text (mariner's obj: on demand)
+                        if (c != _marinerCell) {
+                            S57_newLOD(geo);
+                            if (S57_AREAS_T == S57_getObjtype(geo))
+                                S57_newPole(geo);
+                        }
                     }
                 }
             }
@@ -1406,6 +1513,7 @@ static int        _projectCells(void)
                     S57_geo *geo  = S52_PL_getGeo(obj);
                     S57_geo2prj(geo);
                 }
+                _indexLights(c);
             }
             c->projDone = TRUE;
         }
@@ -1418,6 +1526,10 @@ static int        _projectCells(void)
 static int        _collect_CS_touch(_cell* c)
 // setup object used by CS
 {
+#ifdef S52_DEBUG
+    GTimer *timer = g_timer_new();
+#endif
+
     for (S52_disPrio i=S52_PRIO_NODATA; i<S52_PRIO_NUM; ++i) {
         for (S52ObjectType j=S52_AREAS; j<S52_N_OBJ; ++j) {
             GPtrArray *rbin = c->renderBin[i][j];
@@ -1446,6 +1558,13 @@ static int        _collect_CS_touch(_cell* c)
         }
     }
 
+#ifdef S52_DEBUG
+    // load time of touch (spatial index) - compare with 'full scan' ratio
+    PRINTF("DEBUG: CS touch %.3f msec [%s]\n", g_timer_elapsed(timer, NULL) * 1000, c->filename->str);
+    S52_CS_statTouch(c->local);
+    g_timer_destroy(timer);
+#endif
+
     // need to do a _resolveCS() at the next _app()
     _doCS = TRUE;
 
@@ -1627,6 +1746,17 @@ DLL int    STD S52_init(int screen_pixels_w, int screen_pixels_h, int screen_mm_
 
     _timer =  g_timer_new();
 
+    _dcltList = g_ptr_array_new();
+    _jrnlSort = g_array_new(FALSE, FALSE, sizeof(_jrnlKey));
+
+    _cullTaskList = g_array_new(FALSE, FALSE, sizeof(_cullTask));
+    for (S52_disPrio i=S52_PRIO_NODATA; i<S52_PRIO_MARINR; ++i) {
+        for (S52ObjectType j=S52_AREAS; j<S52_N_OBJ; ++j) {
+            _marVis[i][j] = g_ptr_array_new();
+            _marTxt[i][j] = g_ptr_array_new();
+        }
+    }
+
     _doInit = FALSE;
 
 
@@ -1677,6 +1807,33 @@ DLL int    STD S52_done(void)
     g_timer_destroy(_timer);
     _timer = NULL;
 
+    g_ptr_array_free(_dcltList, TRUE);
+    _dcltList = NULL;
+    g_array_free(_jrnlSort, TRUE);
+    _jrnlSort = NULL;
+
+    if (NULL != _cullPool) {
+        g_thread_pool_free(_cullPool, TRUE, TRUE);
+        _cullPool = NULL;
+        g_async_queue_unref(_cullDone);
+        _cullDone = NULL;
+    }
+    g_array_free(_cullTaskList, TRUE);
+    _cullTaskList = NULL;
+
+    if (NULL != _csPool) {
+        g_thread_pool_free(_csPool, TRUE, TRUE);
+        _csPool = NULL;
+        g_async_queue_unref(_csDone);
+        _csDone = NULL;
+    }
+    for (S52_disPrio i=S52_PRIO_NODATA; i<S52_PRIO_MARINR; ++i) {
+        for (S52ObjectType j=S52_AREAS; j<S52_N_OBJ; ++j) {
+            g_ptr_array_free(_marVis[i][j], TRUE); _marVis[i][j] = NULL;
+            g_ptr_array_free(_marTxt[i][j], TRUE); _marTxt[i][j] = NULL;
+        }
+    }
+
     _doInit = FALSE;
 
 #ifdef S52_USE_DBUS
@@ -2645,6 +2802,15 @@ DLL int    STD S52_loadCell(const char *encPath, S52_loadObject_cb loadObject_cb
     _doCullLights = TRUE;
     // _app() - compute HO Data Limit
     _doDATCVR     = TRUE;
+
+#ifdef S52_DEBUG
+    // look-up rate of this cell
+    S52_PL_statLUP();
+#endif
+
+    // higher priority label of the new cell can displace the cached placement
+    S52_GL_resetDeclutter();
+    S52_GL_resetTileCache();
 exit:
 
     GMUTEXUNLOCK(&_mp_mutex);
@@ -2731,6 +2897,10 @@ DLL int    STD S52_doneCell(const char *encPath)
     _doDATCVR = TRUE;
 
 exit:
+    // cell or raster unloaded
+    if (TRUE == ret)
+        S52_GL_resetTileCache();
+
     g_free(basename);
     g_free(fname);
 
@@ -3084,24 +3254,7 @@ static S52_obj   *_insertS57geo(_cell *c, S57_geo *geo)
         // insert normal object (ie not a light with sector)
         g_ptr_array_add(c->renderBin[disPrioIdx][obj_t], obj);
 
-        /* optimisation: recompute only CS that change due to new MarParam value
-        // save reference for quickly find CS to re-compute after a MarinerParameter change
-        // will replace the ugly APP() code that handle _doCS
-        const char *CSnm = S52_PL_hasCS(obj);
-        if (NULL != CSnm) {
-            if (0 == strncmp(CSnm, "DEPARE", 5)) g_ptr_array_add(c->DEPARElist, obj);
-            if (0 == strncmp(CSnm, "DEPCNT", 5)) g_ptr_array_add(c->DEPCNTlist, obj);
-            if (0 == strncmp(CSnm, "OBSTRN", 5)) g_ptr_array_add(c->OBSTRNlist, obj);
-            if (0 == strncmp(CSnm, "RESARE", 5)) g_ptr_array_add(c->RESARElist, obj);
-            if (0 == strncmp(CSnm, "WRECKS", 5)) g_ptr_array_add(c->WRECKSlist, obj);
-
-            // GPtrArray *DEPARE01L;  MP
-            // GPtrArray *DEPCNT02L;  MP, OP()
-            // GPtrArray *OBSTRN04L;  OP()
-            // GPtrArray *RESARE02L;  OP()
-            // GPtrArray *WRECKS02L;  OP()
-        }
-        */
+        // Note: CS dependency registered at the next _app() (see _csDepBuild())
     }
 
 #ifdef S52_USE_WORLD
@@ -3442,6 +3595,257 @@ static int        _moveObj(_cell *cell, S52_disPrio oldPrio, S52ObjectType obj_t
     return FALSE;
 }
 
+static guint      _resolveCell(_cell *c)
+// re-resolve CS of all obj in the render bins of this cell and move obj that switched layer
+// return the number of obj resolved
+{
+    guint nObj = 0;
+
+    for (S52_disPrio prio=S52_PRIO_NODATA; prio<S52_PRIO_NUM; ++prio) {
+        // one layer
+        for (S52ObjectType obj_t=S52__META; obj_t<S52_N_OBJ; ++obj_t) {
+            // one object type (render bin)
+            GPtrArray *rbin = c->renderBin[prio][obj_t];
+            for (guint idx=0; idx<rbin->len; ++idx) {
+                // one object
+                S52_obj *obj = (S52_obj *)g_ptr_array_index(rbin, idx);
+
+                S52_PL_resloveSMB(obj);
+                ++nObj;
+            }
+        }
+    }
+
+    for (S52_disPrio prio=S52_PRIO_NODATA; prio<S52_PRIO_NUM; ++prio) {
+        for (S52ObjectType obj_t=S52__META; obj_t<S52_N_OBJ; ++obj_t) {
+            GPtrArray *rbin = c->renderBin[prio][obj_t];
+            for (guint idx=0; idx<rbin->len; ++idx) {
+                int check = TRUE;
+                while (TRUE == check)
+                    check = _moveObj(c, prio, obj_t, rbin, idx);
+            }
+        }
+    }
+
+    return nObj;
+}
+
+static int        _csDepAdd(_cell *c, S52_obj *obj, guint64 oldDep)
+// register 'obj' for each Mariner's Param its CS read (those not in oldDep)
+{
+    guint64 dep = S52_PL_getCSdep(obj) & ~oldDep;
+
+    for (int p=0; (0!=dep) && (p<S52_MAR_NUM); ++p, dep>>=1) {
+        if (0 == (dep & 1))
+            continue;
+
+        if (NULL == c->csDep[p])
+            c->csDep[p] = g_ptr_array_new();
+        g_ptr_array_add(c->csDep[p], obj);
+    }
+
+    return TRUE;
+}
+
+static int        _csDepDel(_cell *c, S52_obj *obj, guint64 delDep)
+// unregister 'obj' from each Mariner's Param in delDep - its CS don't read them anymore
+{
+    for (int p=0; (0!=delDep) && (p<S52_MAR_NUM); ++p, delDep>>=1) {
+        if ((0 == (delDep & 1)) || (NULL == c->csDep[p]))
+            continue;
+
+        g_ptr_array_remove_fast(c->csDep[p], obj);
+    }
+
+    return TRUE;
+}
+
+static int        _csDepBuild(_cell *c)
+// (re)build the CS dependency registry of this cell - after all CS have been resolved
+{
+    for (int p=0; p<S52_MAR_NUM; ++p) {
+        if (NULL != c->csDep[p])
+            g_ptr_array_set_size(c->csDep[p], 0);
+    }
+
+    for (S52_disPrio prio=S52_PRIO_NODATA; prio<S52_PRIO_NUM; ++prio) {
+        for (S52ObjectType obj_t=S52__META; obj_t<S52_N_OBJ; ++obj_t) {
+            GPtrArray *rbin = c->renderBin[prio][obj_t];
+            for (guint idx=0; idx<rbin->len; ++idx) {
+                S52_obj *obj = (S52_obj *)g_ptr_array_index(rbin, idx);
+                _csDepAdd(c, obj, 0);
+            }
+        }
+    }
+
+    return TRUE;
+}
+
+static int        _csDepMove(_cell *c, S52_obj *obj, S52_disPrio oldPrio)
+// move 'obj' to the render bin of its new priority (CS override)
+{
+    S52ObjectType obj_t = S52__META;
+    switch (S57_getObjtype(S52_PL_getGeo(obj))) {
+        case S57__META_T: obj_t = S52__META; break;
+        case S57_AREAS_T: obj_t = S52_AREAS; break;
+        case S57_LINES_T: obj_t = S52_LINES; break;
+        case S57_POINT_T: obj_t = S52_POINT; break;
+        default:
+            PRINTF("ERROR: unknown index of addressed object type\n");
+            g_assert(0);
+            return FALSE;
+    }
+
+    if (FALSE == g_ptr_array_remove_fast(c->renderBin[oldPrio][obj_t], obj)) {
+        PRINTF("ERROR: no object to remove\n");
+        g_assert(0);
+        return FALSE;
+    }
+    g_ptr_array_add(c->renderBin[S52_PL_getDPRI(obj)][obj_t], obj);
+
+    return TRUE;
+}
+
+static guint      _resolveCSdep(_cell *c, guint64 changed)
+// re-resolve only the CS of this cell that read a Mariner's Param in 'changed' (S52_MP_BIT())
+// return the number of obj resolved
+{
+    guint   nObj = 0;
+    guint64 done = 0;  // param allready processed - obj that depend on many param done once
+
+    for (int p=0; p<S52_MAR_NUM; ++p) {
+        if (0 == (changed & S52_MP_BIT(p)))
+            continue;
+
+        GPtrArray *dep = c->csDep[p];
+        if (NULL != dep) {
+            for (guint idx=0; idx<dep->len; ) {
+                S52_obj    *obj     = (S52_obj *)g_ptr_array_index(dep, idx);
+                guint64     oldDep  = S52_PL_getCSdep(obj);
+                S52_disPrio oldPrio = S52_PL_getDPRI(obj);
+
+                if (0 != (oldDep & done)) {
+                    ++idx;
+                    continue;
+                }
+
+                S52_PL_resloveSMB(obj);
+                ++nObj;
+
+                if (oldPrio != S52_PL_getDPRI(obj))
+                    _csDepMove(c, obj, oldPrio);
+
+                // this CS took a new branch - register new param, unregister param not read anymore
+                // so the registry don't grow with each change
+                guint64 newDep = S52_PL_getCSdep(obj);
+                if (oldDep != newDep) {
+                    _csDepAdd(c, obj, oldDep);
+
+                    // 'dep' is being walked - drop 'obj' at 'idx' in place, the last obj move to 'idx'
+                    if (0 == (newDep & S52_MP_BIT(p))) {
+                        g_ptr_array_remove_index_fast(dep, idx);
+                        _csDepDel(c, obj, (oldDep & ~newDep) & ~S52_MP_BIT(p));
+                        continue;
+                    }
+
+                    _csDepDel(c, obj, oldDep & ~newDep);
+                }
+
+                ++idx;
+            }
+        }
+
+        done |= S52_MP_BIT(p);
+    }
+
+    return nObj;
+}
+
+static int        _resolveCStask(_csTask *t)
+// resolve the CS of one cell
+{
+    if (0 == t->changed) {
+        // all CS, then register obj by Mariner's Param their CS read
+        t->nObj = _resolveCell(t->c);
+        if (_marinerCell != t->c)
+            _csDepBuild(t->c);
+    } else {
+        // mariner obj are created / deleted by the user, no registry - few obj anyway
+        if (_marinerCell == t->c)
+            t->nObj = _resolveCell(t->c);
+        else
+            t->nObj = _resolveCSdep(t->c, t->changed);
+    }
+
+    return TRUE;
+}
+
+static void       _resolveCSworker(gpointer data, gpointer user_data)
+// thread pool func - resolve the CS of one cell
+{
+    // quiet compiler
+    (void)user_data;
+
+    _csTask *t = (_csTask *)data;
+
+    _resolveCStask(t);
+
+    g_async_queue_push(_csDone, t);
+
+    return;
+}
+
+// forward decl
+static guint      _setPool(S52MarinerParameter paramID, GThreadPool **pool, GAsyncQueue **done, GFunc func);
+
+static int        _resolveCS(guint64 changed)
+// resolve CS of all cells, one task per cell - 'changed' 0: all CS, else only CS that depend on it
+{
+#ifdef S52_DEBUG
+    gdouble t0 = g_timer_elapsed(_timer, NULL);
+#endif
+
+    GArray *tasks = g_array_sized_new(FALSE, FALSE, sizeof(_csTask), _cellList->len);
+    for (guint i=0; i<_cellList->len; ++i) {
+        _csTask t = {(_cell*) g_ptr_array_index(_cellList, i), changed, 0};
+        g_array_append_val(tasks, t);
+    }
+
+    guint nThread = _setPool(S52_MAR_CS_THREAD, &_csPool, &_csDone, _resolveCSworker);
+    guint nPush   = 0;
+    for (guint i=0; i<tasks->len; ++i) {
+        _csTask *t = &g_array_index(tasks, _csTask, i);
+        // FIXME: mariner CS (OWNSHP, VESSEL, LEGLIN, ..) not checked for re-entrance - main thread
+        if ((0==nThread) || (_marinerCell==t->c)) {
+            _resolveCStask(t);
+        } else {
+            g_thread_pool_push(_csPool, t, NULL);
+            ++nPush;
+        }
+    }
+
+    // wait for all the workers
+    for (guint i=0; i<nPush; ++i)
+        g_async_queue_pop(_csDone);
+
+    guint nObj = 0;
+    for (guint i=0; i<tasks->len; ++i)
+        nObj += g_array_index(tasks, _csTask, i).nObj;
+
+#ifdef S52_DEBUG
+    // CS time, compare serial / parallel (S52_MAR_CS_THREAD 0 / 4 / 8, see s52egl.c key c)
+    PRINTF("DEBUG: CS %.3f msec, %u obj, %u cells, %u thread\n", (g_timer_elapsed(_timer, NULL) - t0) * 1000, nObj, tasks->len, nThread);
+#endif
+
+    // debug - dedup ratio of CS output / parsed command list
+    //S52_PL_statCmdL();
+    (void)nObj;
+
+    g_array_free(tasks, TRUE);
+
+    return TRUE;
+}
+
 // forward decl
 static S52ObjectHandle _newMarObj(const char *plibObjName, S52ObjectType objType, unsigned int xyznbr, double *xyz, const char *listAttVal);
 static S52_obj        *_updateGeo(S52_obj *obj, double *xyz);
@@ -3458,57 +3862,28 @@ static int        _app()
     // So the idea to move back the CS logic into CS.c is an esthetic one!
     // 2 -
     if (TRUE == _doCS) {
-        // 2.1 - reparse CS
+        // 2.1 - reparse all CS, move obj that switched layer
+        // 2.2 - register obj by Mariner's Param their CS read
         // FIXME: no need to check mariner cell if all mariner CS is in GL (S52_MP_get(S52_MAR_VECMRK))
-        for (guint i=0; i<_cellList->len; ++i) {
-            _cell *ci = (_cell*) g_ptr_array_index(_cellList, i);
-            // one cell
-            for (S52_disPrio prio=S52_PRIO_NODATA; prio<S52_PRIO_NUM; ++prio) {
-                // one layer
-                for (S52ObjectType obj_t=S52__META; obj_t<S52_N_OBJ; ++obj_t) {
-                    // one object type (render bin)
-                    GPtrArray *rbin = ci->renderBin[prio][obj_t];
-                    for (guint idx=0; idx<rbin->len; ++idx) {
-                        // one object
-                        S52_obj *obj = (S52_obj *)g_ptr_array_index(rbin, idx);
-
-                        S52_PL_resloveSMB(obj);
-                    }
-                }
-            }
-        }
-
-        //PRINTF("_app(): -0-\n");
-        // 2.2 - move obj
-        for (guint i=0; i<_cellList->len; ++i) {
-            _cell *ci = (_cell*) g_ptr_array_index(_cellList, i);
-            // one cell
-            for (S52_disPrio prio=S52_PRIO_NODATA; prio<S52_PRIO_NUM; ++prio) {
-                // one layer
-                for (S52ObjectType obj_t=S52__META; obj_t<S52_N_OBJ; ++obj_t) {
-                    // one object type (render bin)
-                    GPtrArray *rbin = ci->renderBin[prio][obj_t];
-                    for (guint idx=0; idx<rbin->len; ++idx) {
-                        // one object
-                        int check = TRUE;
-                        while (TRUE == check)
-                            check = _moveObj(ci, prio, obj_t, rbin, idx);
-                    }
-                }
-            }
-        }
-
+        _resolveCS(0);
+    } else {
+        // 2.1 - reparse only CS that depend on the Mariner's Param that changed
+        if (0 != _doCSdep)
+            _resolveCS(_doCSdep);
+    }
 
-        // 2.3 - flush all texApha, when raster is bathy, if S52_MAR_SAFETY_CONTOUR / S52_MAR_DEEP_CONTOUR has change
-        // FIXME: find if SAFETY_CONTOUR / S52_MAR_DEEP_CONTOUR has change
+    // 2.3 - flush all texApha, when raster is bathy, if S52_MAR_SAFETY_CONTOUR / S52_MAR_DEEP_CONTOUR has change
+    if ((TRUE == _doCS) || (0 != (_doCSdep & (S52_MP_BIT(S52_MAR_SAFETY_CONTOUR) | S52_MP_BIT(S52_MAR_DEEP_CONTOUR))))) {
         for (guint i=0; i<_rasterList->len; ++i) {
             S52_GL_ras *ras = (S52_GL_ras *) g_ptr_array_index(_rasterList, i);
             S52_GL_delRaster(ras, TRUE);
         }
-        // done rebuilding CS
-        _doCS = FALSE;
     }
 
+    // done rebuilding CS
+    _doCS    = FALSE;
+    _doCSdep = 0;
+
     ////////////////////////////////////////////////////
     //
     // CS DATCVR01: compute HO Data Limit, scale boundary, ..
@@ -3676,6 +4051,9 @@ static int        _resetJournal(void)
 static int        _cullLights(void)
 // CULL (first draw() after APP, on all cells)
 {
+    // cell 'above' of larger scale that overlap the current cell
+    GPtrArray *above = g_ptr_array_new();
+
     // FIXME: this compare to cell 'above', but len-1 could rollover
     for (guint i=_cellList->len-1; i>0 ; --i) {
         _cell *c = (_cell*) g_ptr_array_index(_cellList, i);
@@ -3686,6 +4064,18 @@ static int        _cullLights(void)
             continue;
         }
 
+        // once per cell instead of once per light
+        g_ptr_array_set_size(above, 0);
+        for (guint k=i-1; k>0 ; --k) {
+            _cell *cellAbove = (_cell*) g_ptr_array_index(_cellList, k);
+            // skip if same scale
+            // FIXME: use A->dsid_intustr;       // intended usage (nav purp)
+            if (cellAbove->filename->str[2] > c->filename->str[2]) {
+                if (TRUE == _intersec(cellAbove->geoExt, c->geoExt))
+                    g_ptr_array_add(above, cellAbove);
+            }
+        }
+
         // FIXME: use for_each()
         for (guint j=0; j<c->lights_sector->len; ++j) {
             S52_obj *obj = (S52_obj *)g_ptr_array_index(c->lights_sector, j);
@@ -3696,30 +4086,55 @@ static int        _cullLights(void)
             S52_PL_resloveSMB(obj);
 
             // traverse the cell 'above' to check if extent overlap this light
-            for (guint k=i-1; k>0 ; --k) {
-                _cell *cellAbove = (_cell*) g_ptr_array_index(_cellList, k);
-                // skip if same scale
-                // FIXME: use A->dsid_intustr;       // intended usage (nav purp)
-                if (cellAbove->filename->str[2] > c->filename->str[2]) {
-                    if (TRUE == _intersec(cellAbove->geoExt, oext)) {
-                        // check this: a chart above this light sector
-                        // does not have the same lights (this would be a bug in S57)
-                        //S57_setSupp(geo, TRUE);
-                        S52_PL_setSupp(obj, TRUE);
-                    }
+            for (guint k=0; k<above->len; ++k) {
+                _cell *cellAbove = (_cell*) g_ptr_array_index(above, k);
+                if (TRUE == _intersec(cellAbove->geoExt, oext)) {
+                    // check this: a chart above this light sector
+                    // does not have the same lights (this would be a bug in S57)
+                    //S57_setSupp(geo, TRUE);
+                    S52_PL_setSupp(obj, TRUE);
+                    break;
                 }
             }
         }
     }
 
+    g_ptr_array_free(above, TRUE);
+
     return TRUE;
 }
 
-static int        _cullObj(_cell *c, GPtrArray *rbin)
+static int        _isCulled(S52_obj *obj, guint *nClip)
+// TRUE if obj is suppressed or outside the view
+// Note: called from the cull task (worker thread) - no write here but the task counter 'nClip'
+{
+    // is *this* object suppressed by user
+    if (TRUE == S52_PL_getSupp(obj))
+        return TRUE;
+
+    // SCAMIN & PLib (disp cat) & S57 class
+    if (TRUE == S52_GL_isSupp(obj)) {
+        ++*nClip;
+        return TRUE;
+    }
+
+    // outside view
+    // NOTE: object can be inside 'ext' but outside the 'view' (cursor pick)
+    if (TRUE == S52_GL_isOFFview(obj)) {
+        ++*nClip;
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+static int        _cullObj(_cullTask *t, GPtrArray *rbin)
 // cull object out side the view and object supressed
 // object culled are not inserted in the list of object to draw (journal)
 // Note: extent are taken from the obj itself
 {
+    _cell *c = t->c;
+
     // for each object
     for (guint idx=0; idx<rbin->len; ++idx) {
         S52_obj *obj = (S52_obj *)g_ptr_array_index(rbin, idx);
@@ -3731,7 +4146,7 @@ static int        _cullObj(_cell *c, GPtrArray *rbin)
             continue;
         }
 
-        ++_nTotal;
+        ++t->nTotal;
 
         // debug - anti-meridian, US5HA06M/US5HA06M.000
         //if (103 == S57_getGeoS57ID(geo)) {
@@ -3750,22 +4165,8 @@ static int        _cullObj(_cell *c, GPtrArray *rbin)
         //    //g_assert(0);
         //}
 
-        // is *this* object suppressed by user
-        if (TRUE == S52_PL_getSupp(obj)) {
-            ++_nCull;
-            continue;
-        }
-
-        // SCAMIN & PLib (disp cat) & S57 class
-        if (TRUE == S52_GL_isSupp(obj)) {
-            ++_nCull;
-            continue;
-        }
-
-        // outside view
-        // NOTE: object can be inside 'ext' but outside the 'view' (cursor pick)
-        if (TRUE == S52_GL_isOFFview(obj)) {
-            ++_nCull;
+        if (TRUE == _isCulled(obj, &t->nClip)) {
+            ++t->nCull;
             continue;
         }
 
@@ -3786,6 +4187,7 @@ static int        _cullObj(_cell *c, GPtrArray *rbin)
         }
 
         // if this object has TX or TE, draw text last (on top)
+        // Note: S52_PL_hasText() move the command word cursor of obj - obj of this cell only
         if (TRUE == S52_PL_hasText(obj)) {
             g_ptr_array_add(c->textList, obj);
         }
@@ -3794,7 +4196,70 @@ static int        _cullObj(_cell *c, GPtrArray *rbin)
     return TRUE;
 }
 
-static int        _cullLayer(_cell *c)
+static int        _cullMarObj(_cullTask *t, S52_disPrio i, S52ObjectType j)
+// merge mariner obj culled by _cullMar() in the journal of this cell
+// (same order as if culled with the obj of the cell)
+{
+    _cell     *c      = t->c;
+    GPtrArray *m_rbin = _marinerCell->renderBin[i][j];
+    GPtrArray *vis    = _marVis[i][j];
+
+    t->nTotal += m_rbin->len;
+    t->nCull  += m_rbin->len - vis->len;
+
+    for (guint idx=0; idx<vis->len; ++idx) {
+        S52_obj *obj = (S52_obj *)g_ptr_array_index(vis, idx);
+
+        if (S52_RAD_SUPP == S52_PL_getRPRI(obj))
+            g_ptr_array_add(c->objList_supp, obj);
+        else
+            g_ptr_array_add(c->objList_over, obj);
+    }
+
+    GPtrArray *txt = _marTxt[i][j];
+    for (guint idx=0; idx<txt->len; ++idx)
+        g_ptr_array_add(c->textList, g_ptr_array_index(txt, idx));
+
+    return TRUE;
+}
+
+static int        _cullMar(void)
+// cull mariner obj (layer 0-8) once for all cells - in the main thread
+// Note: mariner obj are shared by all cells journal, so the write (highlight, command word cursor)
+// can't be done from the cull task
+{
+    for (S52_disPrio i=S52_PRIO_NODATA; i<S52_PRIO_MARINR; ++i) {
+        for (S52ObjectType j=S52_AREAS; j<S52_N_OBJ; ++j) {
+            GPtrArray *m_rbin = _marinerCell->renderBin[i][j];
+
+            g_ptr_array_set_size(_marVis[i][j], 0);
+            g_ptr_array_set_size(_marTxt[i][j], 0);
+
+            for (guint idx=0; idx<m_rbin->len; ++idx) {
+                S52_obj *obj = (S52_obj *)g_ptr_array_index(m_rbin, idx);
+
+                // main thread
+                if ((NULL==obj) || (TRUE==_isCulled(obj, &_nClip)))
+                    continue;
+
+                g_ptr_array_add(_marVis[i][j], obj);
+
+                if (S52_RAD_SUPP != S52_PL_getRPRI(obj)) {
+                    S57_geo *geo = S52_PL_getGeo(obj);
+                    if (0.0==S52_MP_get(S52_MAR_GUARDZONE_ALARM) && TRUE==S57_isHighlighted(geo))
+                        S57_highlightOFF(geo);
+                }
+
+                if (TRUE == S52_PL_hasText(obj))
+                    g_ptr_array_add(_marTxt[i][j], obj);
+            }
+        }
+    }
+
+    return TRUE;
+}
+
+static int        _cullLayer(_cullTask *t)
 // one cell, cull object out side the view and object supressed
 // object culled are not inserted in the list of object to draw (journal)
 // Note: extent are taken from the obj itself
@@ -3810,16 +4275,70 @@ static int        _cullLayer(_cell *c)
             // FIXME: AA line & point, mark in journal to render to texture
             // then send texture to FB
 
-            GPtrArray *c_rbin = c->renderBin[i][j];
-            _cullObj(c, c_rbin);
-            GPtrArray *m_rbin = _marinerCell->renderBin[i][j];
-            _cullObj(c, m_rbin);
+            GPtrArray *c_rbin = t->c->renderBin[i][j];
+            _cullObj(t, c_rbin);
+            _cullMarObj(t, i, j);
         }
     }
 
     return TRUE;
 }
 
+static void       _cullWorker(gpointer data, gpointer user_data)
+// thread pool func - cull one cell
+// Note: only the cull (supp, SCAMIN, view extent) run here and fill the journal of the cell.
+// The rest of the frame work (text, LC, centroid, matrix) is still done by S52_GL_draw()
+// in the GL thread - there is no per-cell command buffer. CS run in its own pool (S52_MAR_CS_THREAD).
+{
+    // quiet compiler
+    (void)user_data;
+
+    _cullTask *t = (_cullTask *)data;
+
+    _cullLayer(t);
+
+    g_async_queue_push(_cullDone, t);
+
+    return;
+}
+
+static guint      _setPool(S52MarinerParameter paramID, GThreadPool **pool, GAsyncQueue **done, GFunc func)
+// start / resize a thread pool of N worker, N is the value of Mariner's Param 'paramID'
+// return the number of worker thread, 0 - work in the main thread
+{
+    guint nThread = (guint) S52_MP_get(paramID);
+    if (0 == nThread)
+        return 0;
+
+    if (NULL == *pool) {
+        GError *error = NULL;
+        *pool = g_thread_pool_new(func, NULL, nThread, FALSE, &error);
+        if (NULL != error) {
+            PRINTF("WARNING: g_thread_pool_new() failed (%s), work in main thread\n", error->message);
+            g_error_free(error);
+            if (NULL != *pool) {
+                g_thread_pool_free(*pool, TRUE, TRUE);
+                *pool = NULL;
+            }
+            S52_MP_set(paramID, 0.0);
+            return 0;
+        }
+        *done = g_async_queue_new();
+    } else {
+        if (nThread != (guint)g_thread_pool_get_max_threads(*pool))
+            g_thread_pool_set_max_threads(*pool, nThread, NULL);
+    }
+
+    return nThread;
+}
+
+static guint      _cullSetPool(void)
+// start / resize the cull thread pool (S52_MAR_DISP_CULL_THREAD)
+// return the number of worker thread, 0 - cull in the main thread
+{
+    return _setPool(S52_MAR_DISP_CULL_THREAD, &_cullPool, &_cullDone, _cullWorker);
+}
+
 static int        _cull(extent ext)
 // FIXME: allow for chart rotation - north != 0.0
 // cull chart not in view extent
@@ -3831,7 +4350,13 @@ static int        _cull(extent ext)
     // FIXME: mariner layer must be embeded in each cell
     // ex: mariner layer[8] for route
     // cull mariners' at each layer glScissor() will clip
+    _cullMar();
 
+#ifdef S52_DEBUG
+    gdouble t0 = g_timer_elapsed(_timer, NULL);
+#endif
+
+    g_array_set_size(_cullTaskList, 0);
 
     // all cells - larger region first (small scale)
     //for (guint i=_cellList->len; i>0; --i) {
@@ -3843,13 +4368,101 @@ static int        _cull(extent ext)
 #endif
         // is this chart visible
         if (TRUE == _intersec(c->geoExt, ext)) {
-            //_cullObj(c);
-            _cullLayer(c);
+            _cullTask t = {c, 0, 0, 0};
+            g_array_append_val(_cullTaskList, t);
         }
     }
 
+    // Note: each task fill the journal of its own cell, so journal order is the same
+    // whatever the number of thread
+    guint nThread = _cullSetPool();
+    for (guint i=0; i<_cullTaskList->len; ++i) {
+        _cullTask *t = &g_array_index(_cullTaskList, _cullTask, i);
+        if (0 == nThread)
+            _cullLayer(t);
+        else
+            g_thread_pool_push(_cullPool, t, NULL);
+    }
+
+    // wait for all the workers
+    if (0 < nThread) {
+        for (guint i=0; i<_cullTaskList->len; ++i)
+            g_async_queue_pop(_cullDone);
+    }
+
+    for (guint i=0; i<_cullTaskList->len; ++i) {
+        _cullTask *t = &g_array_index(_cullTaskList, _cullTask, i);
+        _nTotal += t->nTotal;
+        _nCull  += t->nCull;
+        _nClip  += t->nClip;
+    }
+
+#ifdef S52_DEBUG
+    // cull time, compare 0 / 1 / 4 / 8 thread (S52_MAR_DISP_CULL_THREAD, see s52egl.c F11)
+    PRINTF("DEBUG: cull %.3f msec, %u cells, %u thread\n", (g_timer_elapsed(_timer, NULL) - t0) * 1000, _cullTaskList->len, nThread);
+#endif
+
     // debug
-    //PRINTF("DEBUG: nbr of object culled: %i (%i)\n", _nCull, _nTotal);
+    //PRINTF("DEBUG: nbr of object culled: %i (%i), clipped: %i\n", _nCull, _nTotal, _nClip);
+
+    return TRUE;
+}
+
+static gint       _cmpState(gconstpointer a, gconstpointer b)
+{
+    const _jrnlKey *A = (const _jrnlKey *)a;
+    const _jrnlKey *B = (const _jrnlKey *)b;
+
+    if (A->state != B->state)
+        return (A->state < B->state) ? -1 : 1;
+
+    // same state - keep journal order
+    return (int)A->idx - (int)B->idx;
+}
+
+static int        _sortJournalList(GPtrArray *objList)
+// group obj by GL state inside each run of obj of the same display priority and type
+// Note: the journal is filled layer by layer, so S52 draw order between runs is unchanged
+{
+    guint s = 0;
+    while (s < objList->len) {
+        S52_obj     *obj  = (S52_obj *)g_ptr_array_index(objList, s);
+        S52_disPrio  prio = S52_PL_getDPRI(obj);
+        S57_Obj_t    type = S57_getObjtype(S52_PL_getGeo(obj));
+
+        g_array_set_size(_jrnlSort, 0);
+
+        guint e = s;
+        for (; e<objList->len; ++e) {
+            S52_obj *o = (S52_obj *)g_ptr_array_index(objList, e);
+            if ((prio!=S52_PL_getDPRI(o)) || (type!=S57_getObjtype(S52_PL_getGeo(o))))
+                break;
+
+            _jrnlKey k = {o, S52_GL_getStateKey(o), e};
+            g_array_append_val(_jrnlSort, k);
+        }
+
+        if (1 < _jrnlSort->len) {
+            g_array_sort(_jrnlSort, _cmpState);
+            for (guint i=0; i<_jrnlSort->len; ++i)
+                g_ptr_array_index(objList, s+i) = g_array_index(_jrnlSort, _jrnlKey, i).obj;
+        }
+
+        s = e;
+    }
+
+    return TRUE;
+}
+
+static int        _sortJournal(void)
+// sort journal to minimise GL state change (S52_MAR_DISP_STATE_SORT)
+{
+    // skip mariner
+    for (guint i=1; i<_cellList->len; ++i) {
+        _cell *c = (_cell*) g_ptr_array_index(_cellList, i);
+        _sortJournalList(c->objList_supp);
+        _sortJournalList(c->objList_over);
+    }
 
     return TRUE;
 }
@@ -3971,32 +4584,73 @@ static int        _drawLights(void)
     // also light are drawn last (ie after all cells)
     // so a sector is not shoped by an other cell next to it
 
+    // reach of a sector on screen: legs (25mm) and arc (25mm + 4px), in PRJ,
+    // or the nominal range (VALNMR) in full sector mode
+    double S, W, N, E;
+    int    vpx, vpy, vpw, vph;
+    S52_GL_getPRJView(&S, &W, &N, &E);
+    S52_GL_getViewPort(&vpx, &vpy, &vpw, &vph);
+    double pxReach = ((25.0 / S52_MP_get(S52_MAR_DOTPITCH_MM_X)) + 4.0) * ((E - W) / MAX(1, vpw));
+    int    full    = (TRUE == (int) S52_MP_get(S52_MAR_FULL_SECTORS));
+    guint  nDraw   = 0;
+    guint  nTotal  = 0;
+
+    // sector arc of all lights in one batch
+    S52_GL_lightsBeg();
+
     for (guint i=_cellList->len; i>0 ; --i) {
         _cell *c = (_cell*) g_ptr_array_index(_cellList, i-1);
 
         // a cell can have no lights sector
-        if (NULL == c->lights_sector)
+        if ((NULL==c->lights_sector) || (NULL==c->lights_idx))
             continue;
 
-        // FIXME: use for_each()
-        for (guint j=0; j<c->lights_sector->len; ++j) {
-            S52_obj *obj = (S52_obj *)g_ptr_array_index(c->lights_sector, j);
+        nTotal += c->lights_idx->len;
+
+        // first light that can reach the view
+        double rmax = (TRUE==full) ? MAX(pxReach, c->lights_rmax) : pxReach;
+        double xmin = W - rmax;
+        guint  lo   = 0;
+        guint  hi   = c->lights_idx->len;
+        while (lo < hi) {
+            guint mid = (lo + hi) / 2;
+            if (g_array_index(c->lights_idx, _lightSec, mid).x < xmin)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
 
-            // debug: can this happen!
-            if (NULL == obj) {
-                PRINTF("DEBUG: skip obj NULL\n");
-                g_assert(0);
+        for (guint j=lo; j<c->lights_idx->len; ++j) {
+            _lightSec *ls = &g_array_index(c->lights_idx, _lightSec, j);
+            if (ls->x > (E + rmax))
+                break;
+
+            // bounding circle vs view
+            double r  = (TRUE==full) ? MAX(pxReach, ls->r) : pxReach;
+            double dx = (ls->x < W) ? (W - ls->x) : (ls->x > E) ? (ls->x - E) : 0.0;
+            double dy = (ls->y < S) ? (S - ls->y) : (ls->y > N) ? (ls->y - N) : 0.0;
+            if ((dx*dx + dy*dy) > (r*r))
                 continue;
-            }
+
+            S52_obj *obj = ls->obj;
 
             // SCAMIN & PLib (disp prio)
             if (TRUE != S52_GL_isSupp(obj)) {
-                if (TRUE != S52_PL_getSupp(obj))
+                if (TRUE != S52_PL_getSupp(obj)) {
                     S52_GL_draw(obj, NULL);
+                    ++nDraw;
+                }
             }
         }
     }
 
+    S52_GL_lightsEnd();
+
+    // debug
+    //PRINTF("DEBUG: lights sector drawn %u / %u\n", nDraw, nTotal);
+    (void)nDraw;
+    (void)nTotal;
+
     return TRUE;
 }
 
@@ -4225,6 +4879,8 @@ static int        _draw()
             PRINTF("abort drawing .. \n");
             _backtrace();
             g_atomic_int_set(&_atomicAbort, FALSE);
+            // tile in progress is incomplete
+            S52_GL_resetTileCache();
             return TRUE;
         }
 
@@ -4269,8 +4925,89 @@ static int        _draw()
         S52_GL_setScissor(0, 0, -1, -1);
 
         // draw text
+        // Note: declutter draw text of all cells at the end, in priority order
         // FIXME: implicit call to S52_PL_hasText() again
-        g_ptr_array_foreach(c->textList,     (GFunc)S52_GL_drawText, NULL);
+        if (0.0 == S52_MP_get(S52_MAR_DISP_DECLUTTER)) {
+            g_ptr_array_foreach(c->textList, (GFunc)S52_GL_drawText, NULL);
+
+            // one draw call per cell - the next cell cover this text
+            S52_GL_drawTextEnd();
+        }
+    }
+
+    return TRUE;
+}
+
+static gint       _cmpDPRI(gconstpointer a, gconstpointer b)
+// sort obj: high display priority first
+{
+    S52_obj *A = *(S52_obj**) a;
+    S52_obj *B = *(S52_obj**) b;
+
+    return (int)S52_PL_getDPRI(B) - (int)S52_PL_getDPRI(A);
+}
+
+static int        _declutterSY(void)
+// place point symbol of all cells in the occupancy grid (before any draw)
+// Note: high priority first, then cell order (best scale first, see _cmpCell())
+{
+    g_ptr_array_set_size(_dcltList, 0);
+
+    // skip mariner
+    for (guint i=1; i<_cellList->len; ++i) {
+        _cell *c = (_cell*) g_ptr_array_index(_cellList, i);
+        for (guint j=0; j<c->objList_supp->len; ++j)
+            g_ptr_array_add(_dcltList, g_ptr_array_index(c->objList_supp, j));
+        for (guint j=0; j<c->objList_over->len; ++j)
+            g_ptr_array_add(_dcltList, g_ptr_array_index(c->objList_over, j));
+    }
+
+    // Note: glib sort is stable, cell order kept inside a priority
+    g_ptr_array_sort(_dcltList, _cmpDPRI);
+    g_ptr_array_foreach(_dcltList, (GFunc)S52_GL_declutterSY, NULL);
+
+    return TRUE;
+}
+
+static int        _drawText(void)
+// declutter: draw text of all cells, high priority first, then cell order (best scale first)
+{
+    g_ptr_array_set_size(_dcltList, 0);
+
+    // skip mariner
+    for (guint i=1; i<_cellList->len; ++i) {
+        _cell *c = (_cell*) g_ptr_array_index(_cellList, i);
+        for (guint j=0; j<c->textList->len; ++j)
+            g_ptr_array_add(_dcltList, g_ptr_array_index(c->textList, j));
+    }
+
+    g_ptr_array_sort(_dcltList, _cmpDPRI);
+    g_ptr_array_foreach(_dcltList, (GFunc)S52_GL_drawText, NULL);
+
+    return TRUE;
+}
+
+static int        _drawScene(extent ext)
+// draw chart (all cells)
+{
+    if (TRUE == (int) S52_MP_get(S52_MAR_DISP_OVERLAP)) {
+        for (S52_disPrio layer=S52_PRIO_NODATA; layer<S52_PRIO_NUM; ++layer) {
+            _drawLayer(ext, layer);
+
+            // draw all lights (of all cells) outside ext
+            if (S52_PRIO_HAZRDS == layer)
+                _drawLights();
+        }
+        if (0.0 != S52_MP_get(S52_MAR_DISP_DECLUTTER))
+            _drawText();
+    } else {
+        _draw();
+
+        // complete leg extend from lights outside view
+        _drawLights();
+
+        if (0.0 != S52_MP_get(S52_MAR_DISP_DECLUTTER))
+            _drawText();
     }
 
     return TRUE;
@@ -4314,6 +5051,9 @@ DLL int    STD S52_draw(void)
         // APP:  .. update object
         _app();
 
+        // tile cache: the view become the union of the tiles (edge tile reach past the screen)
+        int tiled = S52_GL_tileBegin();
+
         //////////////////////////////////////////////
         // CULL: .. supress display of object (eg outside view)
         extent ext;
@@ -4348,25 +5088,28 @@ DLL int    STD S52_draw(void)
 
         _cull(ext);
 
+        // point symbol have to be placed before the first one is drawn
+        if (2.0 == S52_MP_get(S52_MAR_DISP_DECLUTTER))
+            _declutterSY();
+
+        // Note: after declutter so that placement doesn't depend on the sort
+        if (1.0 == S52_MP_get(S52_MAR_DISP_STATE_SORT))
+            _sortJournal();
+
         //PRINTF("S52_draw() .. -1.3-\n");
 
         //////////////////////////////////////////////
         // DRAW: .. render
 
-        if (TRUE == (int) S52_MP_get(S52_MAR_DISP_OVERLAP)) {
-            for (S52_disPrio layer=S52_PRIO_NODATA; layer<S52_PRIO_NUM; ++layer) {
-                _drawLayer(ext, layer);
-
-                // draw all lights (of all cells) outside ext
-                if (S52_PRIO_HAZRDS == layer)
-                    _drawLights();
-            }
-            //_drawText();
+        // tile cache: render the missing tiles (to texture) then composite the view
+        // Note: the journal is culled once over all the tiles, S52_GL_draw() skip
+        // the obj outside the (padded) tile being rendered
+        if (TRUE == tiled) {
+            while (TRUE == S52_GL_tileNext())
+                _drawScene(ext);
+            S52_GL_tileEnd();
         } else {
-            _draw();
-
-            // complete leg extend from lights outside view
-            _drawLights();
+            _drawScene(ext);
         }
 
         //PRINTF("S52_draw() .. -1.4-\n");
@@ -4431,6 +5174,7 @@ static void       _delOldVessel(gpointer data, gpointer user_data)
             // remove obj from 'cell'
             g_ptr_array_remove(rbin, obj);
 
+            S52_GL_setDirty(obj);
             _delObj(obj);
         }
     }
@@ -4454,6 +5198,8 @@ static int        _drawLast(void)
                 PRINTF("abort drawing .. \n");
                 _backtrace();
                 g_atomic_int_set(&_atomicAbort, FALSE);
+                // obj not drawn - restore all the view next time
+                S52_GL_setDirty(NULL);
                 return TRUE;
             }
 
@@ -4493,6 +5239,12 @@ static int        _drawLast(void)
 
             // SCAMIN & PLib (disp cat)
             if (FALSE == S52_GL_isSupp(obj)) {
+                // dirty rectangle - obj still on screen (no change, not in a restored area)
+                if (FALSE == S52_GL_isDirty(obj)) {
+                    ++_nCull;
+                    continue;
+                }
+
                 S52_GL_draw(obj, NULL);
                 S52_GL_drawText(obj, NULL);
 
@@ -4540,25 +5292,27 @@ DLL int    STD S52_drawLast(void)
 
     g_timer_reset(_timer);
 
+    // check stray vessel (occur when s52ais/gpsd restart)
+    // Note: before GL begin so that the area of deleted vessel is restored
+    if (0.0 != S52_MP_get(S52_MAR_DISP_VESSEL_DELAY)) {
+        GPtrArray *rbinPT = _marinerCell->renderBin[S52_PRIO_MARINR][S52_POINT];
+        g_ptr_array_foreach(rbinPT, _delOldVessel, rbinPT);
+        GPtrArray *rbinLN = _marinerCell->renderBin[S52_PRIO_MARINR][S52_LINES];
+        g_ptr_array_foreach(rbinLN, _delOldVessel, rbinLN);
+    }
+
     if (TRUE == S52_GL_begin(S52_GL_LAST)) {
 
         ////////////////////////////////////////////////////////////////////
         // APP: no CS code for Mariner - all in GL now
         //_app();
 
-        // check stray vessel (occur when s52ais/gpsd restart)
-        if (0.0 != S52_MP_get(S52_MAR_DISP_VESSEL_DELAY)) {
-            GPtrArray *rbinPT = _marinerCell->renderBin[S52_PRIO_MARINR][S52_POINT];
-            g_ptr_array_foreach(rbinPT, _delOldVessel, rbinPT);
-            GPtrArray *rbinLN = _marinerCell->renderBin[S52_PRIO_MARINR][S52_LINES];
-            g_ptr_array_foreach(rbinLN, _delOldVessel, rbinLN);
-        }
-
         ////////////////////////////////////////////////////////////////////
         // CULL / DRAW:
         //
         _nCull = 0;
         _nTotal= 0;
+        _nClip = 0;
         ret = _drawLast();
         S52_GL_end(S52_GL_LAST);
     } else {
@@ -5186,6 +5940,10 @@ DLL int    STD S52_setS57ObjClassSupp(const char *className, int value)
 
     ret = S52_PL_toggleObjClass(className);
 
+    S52_GL_resetDeclutter();
+    S52_GL_resetTileCache();
+    S52_GL_setDirty(NULL);
+
 exit:
 
     GMUTEXUNLOCK(&_mp_mutex);
@@ -5296,11 +6054,17 @@ DLL int    STD S52_loadPLib(const char *plibName)
             g_ptr_array_free(cell->lights_sector, TRUE);
         }
         cell->lights_sector = tmpCell.lights_sector;
+
+        // same obj - keep the index in sync anyway
+        if ((NULL!=cell->lights_sector) && (NULL!=cell->lights_idx))
+            _indexLights(cell);
     }
 
     // signal to rebuild all cmd
     _doCS = TRUE;
 
+    S52_GL_resetTileCache();
+
     ret = TRUE;
 
 exit:
@@ -5413,6 +6177,7 @@ DLL cchar *STD S52_pickAt(double pixels_x, double pixels_y)
     if (TRUE == S52_GL_begin(S52_GL_PICK)) {
         _nTotal = 0;
         _nCull  = 0;
+        _nClip  = 0;
 
         // filter out objects that don't intersec the pick view
         _cull(ext);
@@ -5604,7 +6369,7 @@ DLL cchar *STD S52_getObjList(const char *cellName, const char *className)
                             }
                             S57_geo *geo = S52_PL_getGeo(obj);
                             //  S57ID / geo / disp cat / disp prio
-                            g_string_append_printf(_S52ObjNmList, ",%i:%c:%c:%i",
+                            g_string_append_printf(_S52ObjNmList, ",%u:%c:%c:%i",
                                                    S57_getGeoS57ID(geo),
                                                    S52_PL_getFTYP(obj),    // same as 'j', but in text equivalent
                                                    S52_PL_getDISC(obj),    //
@@ -5722,6 +6487,7 @@ DLL int    STD S52_setRGB(const char *colorName, unsigned char  R, unsigned char
     PRINTF("colorName:%s, R:%c, G:%c, B:%c\n", colorName, R, G, B);
 
     S52_PL_setRGB(colorName, R, G, B);
+    S52_GL_setDirty(NULL);
 
 exit:
 
@@ -5973,7 +6739,7 @@ DLL int    STD S52_dumpS57IDPixels(const char *toFilename, unsigned int S57ID, u
         goto exit;
 
     if (0 == S57ID) {
-        S52_GL_dumpS57IDPixels(toFilename, NULL, width, height);
+        ret = S52_GL_dumpS57IDPixels(toFilename, NULL, width, height);
     } else {
         S52_obj *obj = S52_PL_isObjValid(S57ID);
         if (NULL != obj)
@@ -5987,6 +6753,130 @@ exit:
     return ret;
 }
 
+static cchar      *_drawTileRet(GString **tilePath, gchar *path)
+// copy the path of this call to the returned (static) buffer - under lock, free 'path'
+{
+    GMUTEXLOCK(&_mp_mutex);
+
+    if (NULL == *tilePath)
+        *tilePath = g_string_new("");
+    g_string_assign(*tilePath, path);
+
+    GMUTEXUNLOCK(&_mp_mutex);
+
+    g_free(path);
+
+    return (*tilePath)->str;
+}
+
+DLL cchar *STD S52_drawTile(unsigned int z, unsigned int x, unsigned int y, const char *format)
+// render XYZ (Web-Mercator) tile, keep it in the disk cache
+// Note: draw in the current GL context (ie use a pbuffer/surfaceless context for headless)
+{
+    static GString *tilePath = NULL;   // returned path - only touched with _mp_mutex held
+
+    return_if_null(format);
+
+    if ((0!=g_strcmp0(format, "png")) && (0!=g_strcmp0(format, "webp"))) {
+        PRINTF("WARNING: tile format '%s' unknown (png or webp)\n", format);
+        return NULL;
+    }
+
+    if ((TILE_ZOOM_MAX < z) || ((1u<<z) <= x) || ((1u<<z) <= y)) {
+        PRINTF("WARNING: tile out of bound (z:%u, x:%u, y:%u)\n", z, x, y);
+        return NULL;
+    }
+
+    gchar      *path     = NULL;       // this call
+    gchar      *dir      = NULL;
+    double      cLat     = 0.0;
+    double      cLon     = 0.0;
+    double      rNM      = 0.0;
+    double      north    = 0.0;
+    int         vpX      = 0;
+    int         vpY      = 0;
+    int         vpW      = 0;
+    int         vpH      = 0;
+    valueBuf    cacheDir = {'\0'};
+
+    S52_CHECK_MUTX_INIT;
+
+    if (FALSE == S52_utils_getConfig(CFG_TILE, cacheDir))
+        g_strlcpy(cacheDir, TILE_DIR, MAXL);
+
+    // cache key: palette, display settings, cells loaded
+    guint cellHash = 5381;
+    for (guint i=0; i<_cellList->len; ++i) {
+        _cell *c = (_cell*) g_ptr_array_index(_cellList, i);
+        cellHash = (cellHash * 33) ^ g_str_hash(c->filename->str);
+    }
+    const char *palNm = S52_PL_getPalTableNm((int) S52_MP_get(S52_MAR_COLOR_PALETTE));
+
+    dir  = g_strdup_printf("%s/%s-%08x-%08x/%u/%u", cacheDir, palNm, S52_MP_getHash(), cellHash, z, x);
+    path = g_strdup_printf("%s/%u.%s", dir, y, format);
+
+    cLat  = _view.cLat;
+    cLon  = _view.cLon;
+    rNM   = _view.rNM;
+    north = _view.north;
+    S52_GL_getViewPort(&vpX, &vpY, &vpW, &vpH);
+
+exit:
+
+    GMUTEXUNLOCK(&_mp_mutex);
+
+    if (NULL == path)
+        return NULL;
+
+    g_mkdir_with_parents(dir, 0755);
+    g_free(dir);
+
+    // cache hit
+    if (TRUE == g_file_test(path, G_FILE_TEST_EXISTS))
+        return _drawTileRet(&tilePath, path);
+
+    // tile extent (deg)
+    double n = (double)(1u << z);
+    double W = x     / n * 360.0 - 180.0;
+    double E = (x+1) / n * 360.0 - 180.0;
+    double N = atan(sinh(M_PI * (1.0 - 2.0 *  y    / n))) * 180.0 / M_PI;
+    double S = atan(sinh(M_PI * (1.0 - 2.0 * (y+1) / n))) * 180.0 / M_PI;
+
+    // FIXME: PRJ is ellipsoidal Mercator, Web-Mercator is spherical (small E-W shift at low zoom)
+    // range out of MIN_RANGE/MAX_RANGE (z=0, high z): S52_draw() would render the user view
+    S52_setViewPort(0, 0, TILE_PX, TILE_PX);
+    int ret = S52_setView((N+S)/2.0, (W+E)/2.0, ((N-S)/2.0)*60.0, 0.0);
+
+    // draw fail (ex: busy) - the FB is stale, don't write it in the cache
+    if (TRUE == ret)
+        ret = S52_draw();
+    if (TRUE == ret)
+        ret = S52_dumpS57IDPixels(path, 0, TILE_PX, TILE_PX);
+
+    // dump is async - tile must be on disk
+    GMUTEXLOCK(&_mp_mutex);
+    S52_GL_dumpSync();
+    GMUTEXUNLOCK(&_mp_mutex);
+
+    // restore user view
+    S52_setViewPort(vpX, vpY, vpW, vpH);
+    S52_setView(cLat, cLon, rNM, north);
+
+    if (FALSE == ret) {
+        PRINTF("WARNING: tile not rendered: %s\n", path);
+        g_free(path);
+        return NULL;
+    }
+
+    if (FALSE == g_file_test(path, G_FILE_TEST_EXISTS)) {
+        PRINTF("WARNING: tile not written: %s\n", path);
+        g_free(path);
+        return NULL;
+    }
+
+    return _drawTileRet(&tilePath, path);
+}
+
 static S52ObjectHandle     _newMarObj(const char *plibObjName, S52ObjectType objType,
                                       unsigned int xyznbr, double *xyz, const char *listAttVal)
 {
@@ -6097,6 +6987,9 @@ static S52ObjectHandle     _newMarObj(const char *plibObjName, S52ObjectType obj
     // doCS now (intead of _app() - expensive)
     S52_PL_resloveSMB(obj);
 
+    // drawLast() - restore the area of this obj, tile cache if drawn in the tiles
+    S52_GL_setDirty(obj);
+
     // set timer for afterglow
     if (0 == g_strcmp0("vessel", S57_getName(geo))) {
         S52_PL_setTimeNow(obj);
@@ -6188,6 +7081,9 @@ static S52ObjectHandle     _delMarObj(S52ObjectHandle objH)
         return objH;
     }
 
+    // drawLast() - restore the area of this obj
+    S52_GL_setDirty(obj);
+
     obj  = _delObj(obj);
     objH = FALSE;
 
@@ -6208,6 +7104,15 @@ DLL S52ObjectHandle STD S52_delMarObj(S52ObjectHandle objH)
 
     objH = _delMarObj(objH);
 
+#ifdef S52_DEBUG
+    // soak test of mariner obj create / delete (see s52egl.c:F10): slot and RSS must stay flat
+    {
+        static guint nDel = 0;
+        if (0 == (++nDel % 10000))
+            S57_statS57ID();
+    }
+#endif
+
     /*
     // validate this obj and remove if found
     S52_obj *obj = S52_PL_isObjValid(objH);
@@ -6241,6 +7146,7 @@ DLL S52ObjectHandle STD S52_toggleDispMarObj(S52ObjectHandle  objH)
 
     S52_obj *obj = S52_PL_isObjValid(objH);
     if (NULL != obj) {
+        S52_GL_setDirty(obj);
         if (TRUE == S52_PL_getSupp(obj)) {
             S52_PL_setSupp(obj, FALSE);
         } else {
@@ -6565,6 +7471,7 @@ DLL S52ObjectHandle STD S52_newLEGLIN(int select, double plnspd, double wholinDi
                 S52_obj *obj = S52_PL_isObjValid(leglinH);
                 if (NULL != obj) {
                     S52_PL_setNextLeg(objPrevLeg, obj);
+                    S52_GL_setDirty(objPrevLeg);
                 }
             }
         }
@@ -6633,6 +7540,9 @@ DLL S52ObjectHandle STD S52_setDimension(S52ObjectHandle objH, double a, double
         goto exit;
     }
 
+    // drawLast() - restore the area of this obj
+    S52_GL_setDirty(obj);
+
     if (TRUE==_isObjNameValid(obj, "ownshp") || TRUE==_isObjNameValid(obj, "vessel")) {
         double shplen = a+b;
         double shpbrd = c+d;
@@ -6679,6 +7589,9 @@ DLL S52ObjectHandle STD S52_setVector(S52ObjectHandle objH, int vecstb, double c
         goto exit;
     }
 
+    // drawLast() - restore the area of this obj
+    S52_GL_setDirty(obj);
+
     if (TRUE==_isObjNameValid(obj, "ownshp") || TRUE==_isObjNameValid(obj, "vessel")) {
         char   attval[80];
         SNPRINTF(attval, 80, "vecstb:%i,cogcrs:%f,sogspd:%f,ctwcrs:%f,stwspd:%f", vecstb, course, speed, course, speed);
@@ -6803,6 +7716,9 @@ DLL S52ObjectHandle STD S52_pushPosition(S52ObjectHandle objH, double latitude,
         goto exit;
     }
 
+    // drawLast() - restore the area of this obj
+    S52_GL_setDirty(obj);
+
     S57_geo *geo = S52_PL_getGeo(obj);
 
     // POINT
@@ -6935,6 +7851,9 @@ DLL S52ObjectHandle STD S52_setVESSELlabel(S52ObjectHandle objH, const char *new
         goto exit;
     }
 
+    // drawLast() - restore the area of this obj
+    S52_GL_setDirty(obj);
+
     // commented for debugging - clutter output
     //PRINTF("label:%s\n", newLabel);
 
@@ -6973,6 +7892,9 @@ DLL S52ObjectHandle STD S52_setVESSELstate(S52ObjectHandle objH, int vesselSelec
         goto exit;
     }
 
+    // drawLast() - restore the area of this obj
+    S52_GL_setDirty(obj);
+
     if (TRUE==_isObjNameValid(obj, "ownshp") || TRUE==_isObjNameValid(obj, "vessel")) {
         char  attval[80] = {'\0'};
         char *attvaltmp  = attval;
@@ -7112,6 +8034,9 @@ DLL S52ObjectHandle STD S52_setVRMEBL(S52ObjectHandle objH, double pixels_x, dou
         goto exit;
     }
 
+    // drawLast() - restore the area of this obj
+    S52_GL_setDirty(obj);
+
     if (TRUE!=_isObjNameValid(obj, "ebline") && TRUE!=_isObjNameValid(obj, "vrmark")) {
         PRINTF("WARNING: not a 'ebline' or 'vrmark' object\n");
         objH = FALSE;
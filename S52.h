@@ -148,7 +148,25 @@ typedef enum S52MarinerParameter {
 
     S52_MAR_DISP_HODATA         = 49,   // 0 - union HO data limit "m_covr"(default), 1 - all HO data limit (M_COVR+m_covr)
 
-    S52_MAR_NUM                 = 50    // number of parameters
+    S52_MAR_DISP_DECLUTTER      = 50,   // 0 - off (default), 1 - text, 2 - text + point symbol
+                                        // (drop item that overlap an item of higher display priority)
+
+    S52_MAR_DISP_TILE_CACHE     = 51,   // 0 - off (default), N - GPU budget (MB) of the tile cache
+                                        // (static chart rendered to texture tiles, north-up only)
+
+    S52_MAR_DISP_STATE_SORT     = 52,   // 0 - off (default), 1 - sort obj by GL state inside a display priority
+                                        // (less GL state change, S52 draw order between priority kept)
+
+    S52_MAR_DISP_CULL_THREAD    = 53,   // 0 - off (default), N - number of worker thread that cull the cells
+                                        // (journal of each cell built in parallel, GL call stay in the main thread)
+
+    S52_MAR_DISP_DIRTY_RECT     = 54,   // 0 - off (default), 1 - drawLast() restore / redraw only the area of mariner obj that change
+                                        // (need a back buffer that survive the swap, ex: EGL_BUFFER_PRESERVED)
+
+    S52_MAR_CS_THREAD           = 55,   // 0 - off (default), N - number of worker thread that resolve the CS of the cells
+                                        // (one task per cell, after load and after a Mariner's Param change)
+
+    S52_MAR_NUM                 = 56    // number of parameters
 } S52MarinerParameter;
 
 // [3] debug - command word filter for profiling
@@ -728,6 +746,11 @@ DLL int    STD S52_getRGB(const char *colorName, unsigned char *R, unsigned char
  *
  * Note: use glReadPixels() instead to get raw pixles.
  *
+ * Note: the file is written in a background thread (on GL3 the pixels are read
+ * asynchronously and land at the end of the next draw()/drawLast()), so it may not
+ * be on disk when this call return. The last dump are flushed by S52_done().
+ * The file type follow the extension: .png, .webp or .tif.
+ *
  * Note: call will fail if no ENC loaded (via S52_loadCell)
  *
  *
@@ -735,6 +758,28 @@ DLL int    STD S52_getRGB(const char *colorName, unsigned char *R, unsigned char
  */
 DLL int    STD S52_dumpS57IDPixels(const char *toFilename, unsigned int S57ID, unsigned int width, unsigned int height);
 
+/**
+ * S52_drawTile: render a Web-Mercator XYZ tile (256 x 256 pixels) to the tile disk cache
+ * @z:      (in): zoom level [0..22]
+ * @x:      (in): tile column [0..2^z-1]
+ * @y:      (in): tile row    [0..2^z-1] (0 at the top, as in OSM / Google)
+ * @format: (in): "png" or "webp" (need GDAL WEBP driver)
+ *
+ * Tile are cached in the directory of the label TILE in s52.cfg (default ./tiles)
+ * under <palette>-<display settings hash>-<cells hash>/z/x/y.<format>
+ * so a second call return the file without rendering.
+ *
+ * The tile is drawn in the current GL context via S52_draw() then the
+ * viewport and view are restored. For headless rendering the host
+ * create a pbuffer or surfaceless EGL context (or OSMesa) before S52_init().
+ *
+ * Note: call will fail if no ENC loaded (via S52_loadCell)
+ *
+ *
+ * Return: (transfer none): path of the tile file, NULL if call fail
+ */
+DLL const char * STD S52_drawTile(unsigned int z, unsigned int x, unsigned int y, const char *format);
+
 
 ///////////////////////////////////////////////////////////////
 //
@@ -760,6 +805,9 @@ DLL int    STD S52_dumpS57IDPixels(const char *toFilename, unsigned int S57ID, u
  *
  * Type used for storing references to S52 objects, the S52ObjectHandle
  * is a fully opaque type without any public data members.
+ * A handle of a deleted object is not valid anymore (the handle carry a
+ * generation count), the call using it fail. Note: the generation wrap after
+ * at least 4M object deleted (1024 reuse of a slot, reused FIFO).
  */
 typedef unsigned int S52ObjectHandle;  // guint S75ID
 
@@ -42,11 +42,35 @@
 #define UWTROC  153   // Underwater rock / awash rock
 #define WRECKS  159   // Wreck
 
+// uniform grid over the extent of the obj of a list - so that S52_CS_touch()
+// test only the obj in the bins overlapped by the extent of geo
+#define TOUCH_GRID_MAX 32   // max bins per side
+
+typedef struct _touchGrid {
+    double     x1, y1;      // grid origin (SW of all obj extent)
+    double     dx, dy;      // bin size
+    guint      nx, ny;      // nbr of bins
+    GArray   **bin;         // nx*ny bins of index (guint) in list, ascending, NULL if empty
+    GArray    *all;         // index of obj without extent - always a candidate
+} _touchGrid;
+
 typedef struct _localObj {
     GPtrArray *lights_list;  // list of: LIGHTS
     GPtrArray *topmar_list;  // list of: LITFLT, LITVES, BOY???; to find floating platform
     GPtrArray *depare_list;  // list of: DEPARE, DRGARE
     GPtrArray *depval_list;  // list of: DEPARE, UNSARE
+
+    // spatial index of the lists above - (re)build at the first S52_CS_touch() after S52_CS_add()
+    gboolean   dirty;
+    _touchGrid lights_grid;
+    _touchGrid topmar_grid;
+    _touchGrid depare_grid;
+    _touchGrid depval_grid;
+    GArray    *cand;         // candidate index (guint) of the last query
+
+    // statistic
+    guint      nScan;        // nbr of obj a full scan of the list would have tested
+    guint      nTest;        // nbr of candidate tested
 } _localObj;
 
 // Note: seem useless S52 specs -- no effect !?
@@ -87,9 +111,189 @@ localObj *S52_CS_init()
     local->depare_list = g_ptr_array_new();
     local->depval_list = g_ptr_array_new();
 
+    local->cand        = g_array_new(FALSE, FALSE, sizeof(guint));
+
     return local;
 }
 
+static int      _touchGridDone(_touchGrid *g)
+{
+    if (NULL != g->bin) {
+        for (guint i=0; i<g->nx*g->ny; ++i) {
+            if (NULL != g->bin[i])
+                g_array_free(g->bin[i], TRUE);
+        }
+        g_free(g->bin);
+    }
+
+    if (NULL != g->all)
+        g_array_free(g->all, TRUE);
+
+    memset(g, 0, sizeof(_touchGrid));
+
+    return TRUE;
+}
+
+static guint    _touchGridIdx(double v, double o, double d, guint n)
+// bin index of v - clamped
+{
+    double i = floor((v - o) / d);
+
+    if (i < 0.0)           return 0;
+    if (i > (double)(n-1)) return n-1;
+
+    return (guint) i;
+}
+
+static int      _touchGridBuild(_touchGrid *g, GPtrArray *list)
+{
+    double x1 =  INFINITY, y1 =  INFINITY;
+    double x2 = -INFINITY, y2 = -INFINITY;
+
+    _touchGridDone(g);
+
+    g->all = g_array_new(FALSE, FALSE, sizeof(guint));
+
+    // extent of all obj
+    for (guint i=0; i<list->len; ++i) {
+        S57_geo *geo = (S57_geo *) g_ptr_array_index(list, i);
+        double   ox1, oy1, ox2, oy2;
+
+        if (FALSE == S57_getExt(geo, &ox1, &oy1, &ox2, &oy2))
+            continue;
+
+        x1 = MIN(x1, ox1);
+        y1 = MIN(y1, oy1);
+        x2 = MAX(x2, ox2);
+        y2 = MAX(y2, oy2);
+    }
+
+    // about one obj per bin for point obj, area span many bins
+    guint side = (guint) ceil(sqrt((double)list->len));
+    side = CLAMP(side, 1, TOUCH_GRID_MAX);
+
+    g->x1 = x1;
+    g->y1 = y1;
+    g->nx = (isinf(x1) || x2<=x1) ? 1 : side;
+    g->ny = (isinf(y1) || y2<=y1) ? 1 : side;
+    g->dx = (1 == g->nx) ? 1.0 : (x2 - x1) / g->nx;
+    g->dy = (1 == g->ny) ? 1.0 : (y2 - y1) / g->ny;
+    g->bin = g_new0(GArray*, g->nx*g->ny);
+
+    // index in ascending order - scan order of the list is kept
+    for (guint i=0; i<list->len; ++i) {
+        S57_geo *geo = (S57_geo *) g_ptr_array_index(list, i);
+        double   ox1, oy1, ox2, oy2;
+
+        if (FALSE == S57_getExt(geo, &ox1, &oy1, &ox2, &oy2)) {
+            g_array_append_val(g->all, i);
+            continue;
+        }
+
+        guint ix1 = _touchGridIdx(ox1, g->x1, g->dx, g->nx);
+        guint ix2 = _touchGridIdx(ox2, g->x1, g->dx, g->nx);
+        guint iy1 = _touchGridIdx(oy1, g->y1, g->dy, g->ny);
+        guint iy2 = _touchGridIdx(oy2, g->y1, g->dy, g->ny);
+
+        for (guint iy=iy1; iy<=iy2; ++iy) {
+            for (guint ix=ix1; ix<=ix2; ++ix) {
+                GArray **bin = &g->bin[iy*g->nx + ix];
+                if (NULL == *bin)
+                    *bin = g_array_new(FALSE, FALSE, sizeof(guint));
+                g_array_append_val(*bin, i);
+            }
+        }
+    }
+
+    return TRUE;
+}
+
+static gint     _cmpIdx(gconstpointer a, gconstpointer b)
+{
+    guint ia = *(const guint *)a;
+    guint ib = *(const guint *)b;
+
+    return (ia < ib) ? -1 : (ia > ib);
+}
+
+static GArray  *_touchGridQuery(_localObj *local, _touchGrid *g, GPtrArray *list, S57_geo *geo)
+// return index (ascending) in 'list' of obj that may intersec geo (superset of _intersecGEO())
+{
+    double x1, y1, x2, y2;
+
+    g_array_set_size(local->cand, 0);
+    local->nScan += list->len;
+
+    // no extent - full scan (as before)
+    if (FALSE==S57_getExt(geo, &x1, &y1, &x2, &y2) || NULL==g->bin) {
+        for (guint i=0; i<list->len; ++i)
+            g_array_append_val(local->cand, i);
+        local->nTest += local->cand->len;
+        return local->cand;
+    }
+
+    // bins overlapped
+    if (!(x2 < g->x1 || y2 < g->y1 ||
+          x1 > g->x1 + g->dx*g->nx ||
+          y1 > g->y1 + g->dy*g->ny))
+    {
+        guint ix1 = _touchGridIdx(x1, g->x1, g->dx, g->nx);
+        guint ix2 = _touchGridIdx(x2, g->x1, g->dx, g->nx);
+        guint iy1 = _touchGridIdx(y1, g->y1, g->dy, g->ny);
+        guint iy2 = _touchGridIdx(y2, g->y1, g->dy, g->ny);
+
+        for (guint iy=iy1; iy<=iy2; ++iy) {
+            for (guint ix=ix1; ix<=ix2; ++ix) {
+                GArray *bin = g->bin[iy*g->nx + ix];
+                if (NULL != bin)
+                    g_array_append_vals(local->cand, bin->data, bin->len);
+            }
+        }
+    }
+
+    g_array_append_vals(local->cand, g->all->data, g->all->len);
+
+    // area in more than one bin - sort back to list order and remove duplicate
+    if (1 < local->cand->len) {
+        guint *idx = (guint *) local->cand->data;
+        guint  n   = 1;
+
+        g_array_sort(local->cand, _cmpIdx);
+        for (guint i=1; i<local->cand->len; ++i) {
+            if (idx[i] != idx[n-1])
+                idx[n++] = idx[i];
+        }
+        g_array_set_size(local->cand, n);
+    }
+
+    local->nTest += local->cand->len;
+
+    return local->cand;
+}
+
+static int      _touchIndex(_localObj *local)
+{
+    _touchGridBuild(&local->lights_grid, local->lights_list);
+    _touchGridBuild(&local->topmar_grid, local->topmar_list);
+    _touchGridBuild(&local->depare_grid, local->depare_list);
+    _touchGridBuild(&local->depval_grid, local->depval_list);
+
+    local->dirty = FALSE;
+
+    return TRUE;
+}
+
+int       S52_CS_statTouch(localObj *local)
+// debug - report candidate tested by S52_CS_touch() vs a full scan of the lists
+{
+    return_if_null(local);
+
+    PRINTF("CS touch: %u candidate tested, %u with full scan (%.1f%%)\n",
+           local->nTest, local->nScan, (0==local->nScan) ? 0.0 : (100.0*local->nTest)/local->nScan);
+
+    return TRUE;
+}
+
 localObj *S52_CS_done(_localObj *local)
 {
     return_if_null(local);
@@ -99,6 +303,12 @@ localObj *S52_CS_done(_localObj *local)
     g_ptr_array_free(local->depare_list, TRUE);
     g_ptr_array_free(local->depval_list, TRUE);
 
+    _touchGridDone(&local->lights_grid);
+    _touchGridDone(&local->topmar_grid);
+    _touchGridDone(&local->depare_grid);
+    _touchGridDone(&local->depval_grid);
+    g_array_free(local->cand, TRUE);
+
     local->lights_list = NULL;
     local->topmar_list = NULL;
     local->depare_list = NULL;
@@ -118,6 +328,8 @@ int       S52_CS_add(_localObj *local, S57_geo *geo)
 
     const char *name = S57_getName(geo);
 
+    local->dirty = TRUE;
+
     ///////////////////////////////////////////////
     // for LIGHTS05
     //
@@ -195,20 +407,25 @@ int       S52_CS_touch(localObj *local, S57_geo *geo)
 // compute witch geo object of this cell "touch" this one (geo)
 // return TRUE
 {
-    static int silent = FALSE;
+    // print once - CS run on the worker pool, so test-and-set the flag
+    static volatile gint silent = FALSE;
 
     return_if_null(local);
     return_if_null(geo);
 
     const char *name = S57_getName(geo);
 
+    if (TRUE == local->dirty)
+        _touchIndex(local);
+
     ////////////////////////////////////////////
     // floating object
     //
     if (0 == g_strcmp0(name, "TOPMAR")) {
         GString *lnam = S57_getAttVal(geo, "LNAM");
-        for (guint i=0; i<local->topmar_list->len; ++i) {
-            S57_geo *other = (S57_geo *) g_ptr_array_index(local->topmar_list, i);
+        GArray *cand = _touchGridQuery(local, &local->topmar_grid, local->topmar_list, geo);
+        for (guint k=0; k<cand->len; ++k) {
+            S57_geo *other = (S57_geo *) g_ptr_array_index(local->topmar_list, g_array_index(cand, guint, k));
 
             // skip if not at same position
             if (FALSE == _intersecGEO(geo, other))
@@ -237,8 +454,9 @@ int       S52_CS_touch(localObj *local, S57_geo *geo)
     // check if this buoy has a lights
     //
     if (0 == g_strcmp0(name, "BOYLAT")) {
-        for (guint i=0; i<local->lights_list->len; ++i) {
-            S57_geo *light = (S57_geo *) g_ptr_array_index(local->lights_list, i);
+        GArray *cand = _touchGridQuery(local, &local->lights_grid, local->lights_list, geo);
+        for (guint k=0; k<cand->len; ++k) {
+            S57_geo *light = (S57_geo *) g_ptr_array_index(local->lights_list, g_array_index(cand, guint, k));
 
             // skip if this light is not at buoy's position
             if (FALSE == _intersecGEO(geo, light))
@@ -249,10 +467,9 @@ int       S52_CS_touch(localObj *local, S57_geo *geo)
                 // lights sheme (next case --lights at the same position)
                 // debug
                 if (NULL != S57_getTouchLIGHTS(light)) {
-                    if (FALSE == silent) {
+                    if (TRUE == g_atomic_int_compare_and_exchange(&silent, FALSE, TRUE)) {
                         PRINTF("FIXME: more than 1 light for the same bouy!!!\n");
                         PRINTF("       (this msg will not repeat)\n");
-                        silent = TRUE;
                     }
                 }
 
@@ -261,10 +478,9 @@ int       S52_CS_touch(localObj *local, S57_geo *geo)
                 // bailout as soon as we got one
                 break;
             } else {
-                if (FALSE == silent) {
+                if (TRUE == g_atomic_int_compare_and_exchange(&silent, FALSE, TRUE)) {
                     PRINTF("FIXME: more than 1 light for the same bouy!!!\n");
                     PRINTF("       (this msg will not repeat)\n");
-                    silent = TRUE;
                 }
             }
         }
@@ -285,8 +501,9 @@ int       S52_CS_touch(localObj *local, S57_geo *geo)
         //    //g_assert(0);
         //}
 
-        for (guint i=0; i<local->lights_list->len; ++i) {
-            S57_geo *other = (S57_geo *) g_ptr_array_index(local->lights_list, i);
+        GArray *cand = _touchGridQuery(local, &local->lights_grid, local->lights_list, geo);
+        for (guint k=0; k<cand->len; ++k) {
+            S57_geo *other = (S57_geo *) g_ptr_array_index(local->lights_list, g_array_index(cand, guint, k));
 
             // skip if not at same position
             if (FALSE == _intersecGEO(geo, other))
@@ -331,7 +548,6 @@ int       S52_CS_touch(localObj *local, S57_geo *geo)
     {
         GString  *lnam     = S57_getAttVal(geo, "LNAM");
         //double  drval    = -UNKNOWN;
-        GString  *drvalstr = S57_getAttVal(geo, "DRVAL1");
         double    drval    = 0.0;
         //double    drvalmin = -INFINITY;
         double    drvalmin = -UNKNOWN;
@@ -340,13 +556,8 @@ int       S52_CS_touch(localObj *local, S57_geo *geo)
         // debug
         //PRINTF("--------------------------\n");
 
-        if (NULL == drvalstr) {
-            drvalstr = S57_getAttVal(geo, "VALDCO");
-            //PRINTF("VALDCO\n");
-        }
-
-        if (NULL != drvalstr) {
-            drval = S52_atof(drvalstr->str);
+        if (TRUE == S57_getAttValD(geo, S57_ATT_DRVAL1, &drval) ||
+            TRUE == S57_getAttValD(geo, S57_ATT_VALDCO, &drval)) {
             //PRINTF("DRVAL:%f\n", drval);
         } else {
             //PRINTF("DRVAL:NULL\n");
@@ -363,8 +574,9 @@ int       S52_CS_touch(localObj *local, S57_geo *geo)
         //    PRINTF("127 found\n");
         //}
 
-        for (guint i=0; i<local->depare_list->len; ++i) {
-            S57_geo *other = (S57_geo *) g_ptr_array_index(local->depare_list, i);
+        GArray *cand = _touchGridQuery(local, &local->depare_grid, local->depare_list, geo);
+        for (guint k=0; k<cand->len; ++k) {
+            S57_geo *other = (S57_geo *) g_ptr_array_index(local->depare_list, g_array_index(cand, guint, k));
             GString *olnam = S57_getAttVal(other, "LNAM");
 
             // strcmp0 will fail if NULL - hence no need to go further
@@ -395,11 +607,8 @@ int       S52_CS_touch(localObj *local, S57_geo *geo)
                 //}
 
                 //*
-                GString *drval2str = S57_getAttVal(other, "DRVAL2");
-
-                if (NULL != drval2str) {
-                    double drval2 = S52_atof(drval2str->str);
-
+                double drval2 = 0.0;
+                if (TRUE == S57_getAttValD(other, S57_ATT_DRVAL2, &drval2)) {
                     // is this area just above (shallower) then this one
                     if (drval2 <= drval) {
                         if (drval2 > drvalmin) {
@@ -414,11 +623,8 @@ int       S52_CS_touch(localObj *local, S57_geo *geo)
                 //*/
 
                 //*
-                GString *drval1str = S57_getAttVal(other, "DRVAL1");
-
-                if (NULL != drval1str) {
-                    double drval1 = S52_atof(drval1str->str);
-
+                double drval1 = 0.0;
+                if (TRUE == S57_getAttValD(other, S57_ATT_DRVAL1, &drval1)) {
                     // is this area just above (shallower) then this one
                     if (drval1 <= drval) {
                         if (drval1 > drvalmin) {
@@ -448,8 +654,9 @@ int       S52_CS_touch(localObj *local, S57_geo *geo)
         (0==g_strcmp0(name, "WRECKS"))
        )
     {
-        for (guint i=0; i<local->depare_list->len; ++i) {
-            S57_geo *candidate = (S57_geo *) g_ptr_array_index(local->depare_list, i);
+        GArray *cand = _touchGridQuery(local, &local->depare_grid, local->depare_list, geo);
+        for (guint k=0; k<cand->len; ++k) {
+            S57_geo *candidate = (S57_geo *) g_ptr_array_index(local->depare_list, g_array_index(cand, guint, k));
 
             // skip if not overlapping
             if (FALSE == _intersecGEO(geo, candidate))
@@ -476,8 +683,8 @@ int       S52_CS_touch(localObj *local, S57_geo *geo)
                         //    S57_setTouch(geo, candidate);
                         //}
                     //} else { // AREA DEPARE and AREA DRGARE
-                        GString *drval1str = S57_getAttVal(candidate, "DRVAL1");
-                        double   drval1    = (NULL == drval1str) ? UNKNOWN : S52_atof(drval1str->str);
+                        double drval1 = UNKNOWN;
+                        S57_getAttValD(candidate, S57_ATT_DRVAL1, &drval1);
                         if (drval1 < drvalmin) {
                             drvalmin = drval1;
                             S57_setTouchDEPARE(geo, candidate);
@@ -502,8 +709,9 @@ int       S52_CS_touch(localObj *local, S57_geo *geo)
         //if (582 == S57_getGeoS57ID(geo))
         //    PRINTF("OBSTRN found\n");
 
-        for (guint i=0; i<local->depval_list->len; ++i) {
-            S57_geo *candidate = (S57_geo *) g_ptr_array_index(local->depval_list, i);
+        GArray *cand = _touchGridQuery(local, &local->depval_grid, local->depval_list, geo);
+        for (guint k=0; k<cand->len; ++k) {
+            S57_geo *candidate = (S57_geo *) g_ptr_array_index(local->depval_list, g_array_index(cand, guint, k));
 
             // skip if extent not overlapping
             if (FALSE == _intersecGEO(geo, candidate))
@@ -517,8 +725,8 @@ int       S52_CS_touch(localObj *local, S57_geo *geo)
                 // link to the swallower
                 if (NULL != crntmin) {
                     double   drvalmin  = INFINITY;
-                    GString *drval1str = S57_getAttVal(candidate, "DRVAL1");
-                    double   drval1    = (NULL == drval1str) ? UNKNOWN : S52_atof(drval1str->str);
+                    double   drval1    = UNKNOWN;
+                    S57_getAttValD(candidate, S57_ATT_DRVAL1, &drval1);
 
                     if (drval1 < drvalmin) {
                         drvalmin = drval1;
@@ -542,23 +750,16 @@ static int      _sectOverlap(S57_geo *geoA, S57_geo *geoB)
 // TRUE if A overlap B and arc of A is bigger, else FALSE
 {
     // check for extend arc radius
-    GString *Asectr1str = S57_getAttVal(geoA, "SECTR1");
-    GString *Asectr2str = S57_getAttVal(geoA, "SECTR2");
-    GString *Bsectr1str = S57_getAttVal(geoB, "SECTR1");
-    GString *Bsectr2str = S57_getAttVal(geoB, "SECTR2");
+    double Asectr1, Asectr2, Bsectr1, Bsectr2;
 
     // check if sector present
-    if (NULL == Asectr1str ||
-        NULL == Asectr2str ||
-        NULL == Bsectr1str ||
-        NULL == Bsectr2str)
+    if (FALSE == S57_getAttValD(geoA, S57_ATT_SECTR1, &Asectr1) ||
+        FALSE == S57_getAttValD(geoA, S57_ATT_SECTR2, &Asectr2) ||
+        FALSE == S57_getAttValD(geoB, S57_ATT_SECTR1, &Bsectr1) ||
+        FALSE == S57_getAttValD(geoB, S57_ATT_SECTR2, &Bsectr2))
         return FALSE;
 
     {
-        double Asectr1 = S52_atof(Asectr1str->str);
-        double Asectr2 = S52_atof(Asectr2str->str);
-        double Bsectr1 = S52_atof(Bsectr1str->str);
-        double Bsectr2 = S52_atof(Bsectr2str->str);
 
         if (Asectr1 > Asectr2) Asectr2 += 360;
         if (Bsectr1 > Bsectr2) Bsectr2 += 360;
@@ -759,11 +960,10 @@ static GString *DATCVR01 (S57_geo *geo)
     // FIXME: display indication of better scale available (?)
 
     // FIXME
-    static int silent = FALSE;
-    if (FALSE == silent) {
+    static volatile gint silent = FALSE;
+    if (TRUE == g_atomic_int_compare_and_exchange(&silent, FALSE, TRUE)) {
         PRINTF("NOTE: DATCVR01/OVERSCALE not computed\n");
         PRINTF("       (this msg will not repeat)\n");
-        silent = TRUE;
     }
 
     return datcvr01;
@@ -771,12 +971,11 @@ static GString *DATCVR01 (S57_geo *geo)
 
 static GString *DATCVR02 (S57_geo *geo)
 {
-    static int silent = FALSE;
+    static volatile gint silent = FALSE;
 
-    if (FALSE == silent) {
+    if (TRUE == g_atomic_int_compare_and_exchange(&silent, FALSE, TRUE)) {
         PRINTF("FIXME: CS(DATCVR02) switch to CS(DATCVR01)\n");
         PRINTF("       (this msg will not repeat)\n");
-        silent = TRUE;
     }
 
     return DATCVR01(geo);
@@ -796,13 +995,12 @@ static GString *DEPARE01 (S57_geo *geo)
     GString *depare01  = NULL;
     int      objl      = 0;
     GString *objlstr   = NULL;
-    GString *drval1str = S57_getAttVal(geo, "DRVAL1");
-    double   drval1    = UNKNOWN;
-    GString *drval2str = S57_getAttVal(geo, "DRVAL2");
+    double   drval1    = -1.0;
     double   drval2    = UNKNOWN;
 
-    drval1 = (NULL == drval1str) ? -1.0        : S52_atof(drval1str->str);
-    drval2 = (NULL == drval2str) ? drval1+0.01 : S52_atof(drval2str->str);
+    S57_getAttValD(geo, S57_ATT_DRVAL1, &drval1);
+    if (FALSE == S57_getAttValD(geo, S57_ATT_DRVAL2, &drval2))
+        drval2 = drval1 + 0.01;
 
     double datum = S52_MP_get(S52_MAR_DATUM_OFFSET);
     drval1 += datum;
@@ -831,12 +1029,11 @@ static GString *DEPARE01 (S57_geo *geo)
 
 static GString *DEPARE02 (S57_geo *geo)
 {
-    static int silent = FALSE;
+    static volatile gint silent = FALSE;
 
-    if (FALSE == silent) {
+    if (TRUE == g_atomic_int_compare_and_exchange(&silent, FALSE, TRUE)) {
         PRINTF("FIXME: CS(DEPARE02) --> CS(DEPARE01)\n");
         PRINTF("       (this msg will not repeat)\n");
-        silent = TRUE;
     }
 
     return DEPARE01(geo);
@@ -844,12 +1041,11 @@ static GString *DEPARE02 (S57_geo *geo)
 
 static GString *DEPARE03 (S57_geo *geo)
 {
-    static int silent = FALSE;
+    static volatile gint silent = FALSE;
 
-    if (FALSE == silent) {
+    if (TRUE == g_atomic_int_compare_and_exchange(&silent, FALSE, TRUE)) {
         PRINTF("FIXME: CS(DEPARE03) --> CS(DEPARE01)\n");
         PRINTF("       (this msg will not repeat)\n");
-        silent = TRUE;
     }
 
     return DEPARE01(geo);
@@ -905,11 +1101,12 @@ static GString *DEPCNT02 (S57_geo *geo)
 
     // DEPARE (line)
     if (DEPARE==objl && S57_LINES_T==S57_getObjtype(geo)) {
-        GString *drval1str = S57_getAttVal(geo, "DRVAL1");
         // NOTE: if drval1 not given then set it to 0.0 (ie. LOW WATER LINE as FAIL-SAFE)
-        double   drval1    = (NULL == drval1str) ? 0.0    : S52_atof(drval1str->str);
-        GString *drval2str = S57_getAttVal(geo, "DRVAL2");
-        double   drval2    = (NULL == drval2str) ? drval1 : S52_atof(drval2str->str);
+        double   drval1    = 0.0;
+        double   drval2    = 0.0;
+        S57_getAttValD(geo, S57_ATT_DRVAL1, &drval1);
+        if (FALSE == S57_getAttValD(geo, S57_ATT_DRVAL2, &drval2))
+            drval2 = drval1;
 
         // paranoia
         if (drval1 > drval2) {
@@ -937,8 +1134,8 @@ static GString *DEPCNT02 (S57_geo *geo)
             //    else {
                     // collect area DEPARE & DRGARE that touch this line
                     S57_geo *geoTouch       = S57_getTouchDEPARE(geo);
-                    GString *drval1touchstr = S57_getAttVal(geoTouch, "DRVAL1");
-                    double   drval1touch    = (NULL == drval1touchstr) ? 0.0 : S52_atof(drval1touchstr->str);
+                    double   drval1touch    = 0.0;
+                    gboolean hasDrval1touch = (NULL == geoTouch) ? FALSE : S57_getAttValD(geoTouch, S57_ATT_DRVAL1, &drval1touch);
 
                     // adjuste datum
                     double datum = S52_MP_get(S52_MAR_DATUM_OFFSET);
@@ -952,7 +1149,7 @@ static GString *DEPCNT02 (S57_geo *geo)
                     //    PRINTF("XXX 491 found\n");
                     //}
 
-                    if (NULL == drval1touchstr) {
+                    if (FALSE == hasDrval1touch) {
                         safe = TRUE;
                         //PRINTF("=== DEPARE: SET SAFETY CONTOUR --> touch NULL: %f\n", drval1);
                     } else {
@@ -987,8 +1184,8 @@ static GString *DEPCNT02 (S57_geo *geo)
         //}
     } else {
         // continuation A (DEPCNT (line))
-        GString *valdcostr = S57_getAttVal(geo, "VALDCO");
-        double   valdco    = (NULL == valdcostr) ? 0.0 : S52_atof(valdcostr->str);
+        double   valdco    = 0.0;
+        S57_getAttValD(geo, S57_ATT_VALDCO, &valdco);
 
         double datum = S52_MP_get(S52_MAR_DATUM_OFFSET);
         valdco += datum;
@@ -1007,8 +1204,8 @@ static GString *DEPCNT02 (S57_geo *geo)
             if (valdco > S52_MP_get(S52_MAR_SAFETY_CONTOUR)) {
                 // collect area DEPARE & DRGARE that touche this line
                 S57_geo *geoTmp    = S57_getTouchDEPARE(geo);
-                GString *drval1str = S57_getAttVal(geoTmp, "DRVAL1");
-                double   drval1    = (NULL == drval1str) ? 0.0 : S52_atof(drval1str->str);
+                double   drval1    = 0.0;
+                gboolean hasDrval1 = (NULL == geoTmp) ? FALSE : S57_getAttValD(geoTmp, S57_ATT_DRVAL1, &drval1);
 
                 // debug
                 //S57_dumpData(geo, FALSE);
@@ -1019,7 +1216,7 @@ static GString *DEPCNT02 (S57_geo *geo)
                 double datum = S52_MP_get(S52_MAR_DATUM_OFFSET);
                 drval1 += datum;
 
-                if (NULL == drval1str) {
+                if (FALSE == hasDrval1) {
                     safe = TRUE;
 
                     //char *name = S57_getName(geoTmp);
@@ -1076,12 +1273,11 @@ static GString *DEPCNT02 (S57_geo *geo)
 
 static GString *DEPCNT03 (S57_geo *geo)
 {
-    static int silent = FALSE;
+    static volatile gint silent = FALSE;
 
-    if (FALSE == silent) {
+    if (TRUE == g_atomic_int_compare_and_exchange(&silent, FALSE, TRUE)) {
         PRINTF("FIXME: CS(DEPCNT03) --> CS(DEPCNT02)\n");
         PRINTF("       (this msg will not repeat)\n");
-        silent = TRUE;
     }
 
     return DEPCNT02(geo);
@@ -1102,8 +1298,8 @@ static double   _DEPVAL01(S57_geo *geo, double least_depth)
 {
     // collect group 1 area DEPARE & DRGARE that touch this point/line/area
     S57_geo *geoTmp    = S57_getTouchDEPVAL(geo);
-    GString *drval1str = S57_getAttVal(geoTmp, "DRVAL1");
-    double   drval1    = (NULL == drval1str) ? UNKNOWN : S52_atof(drval1str->str);
+    double   drval1    = UNKNOWN;
+    gboolean hasDrval1 = (NULL == geoTmp) ? FALSE : S57_getAttValD(geoTmp, S57_ATT_DRVAL1, &drval1);
 
     // NOTE: change procedure to use any incomming geometry
     // on area DEPARE & DRGARE (S52 say to use area UNSARE & DEPARE
@@ -1124,7 +1320,7 @@ static double   _DEPVAL01(S57_geo *geo, double least_depth)
         drval1 += datum;
     }
 
-    if (NULL != drval1str) {
+    if (TRUE == hasDrval1) {
         if (UNKNOWN==least_depth || least_depth<drval1)
             least_depth = drval1;
     }
@@ -1146,12 +1342,11 @@ static double   _DEPVAL02(S57_geo *geo, double least_depth)
 //          the default procedures in conditional procedures OBSTRN and
 //          WRECKS are used.
 {
-    static int silent = FALSE;
+    static volatile gint silent = FALSE;
 
-    if (FALSE == silent) {
+    if (TRUE == g_atomic_int_compare_and_exchange(&silent, FALSE, TRUE)) {
         PRINTF("FIXME: _DEPVAL02 --> _DEPVAL01\n");
         PRINTF("       (this msg will not repeat)\n");
-        silent = TRUE;
     }
 
     return _DEPVAL01(geo, least_depth);
@@ -1201,12 +1396,11 @@ static GString *LEGLIN03 (S57_geo *geo)
 // alongside the leg. It also places the "distance to run" labels and cares for the
 // different presentation of planned & alternate legs.
 {
-    static int silent = FALSE;
+    static volatile gint silent = FALSE;
 
-    if (FALSE == silent) {
+    if (TRUE == g_atomic_int_compare_and_exchange(&silent, FALSE, TRUE)) {
         PRINTF("FIXME: CS(LEGLIN03) switching to CS(LEGLIN02)\n");
         PRINTF("       (this msg will not repeat)\n");
-        silent = TRUE;
     }
 
 
@@ -1248,15 +1442,13 @@ static GString *LIGHTS05 (S57_geo *geo)
     GString *lights05          = g_string_new("");
     //GString *valnmrstr         = S57_getAttVal(geo, "VALNMR");
     //double   valnmr            = 0.0;
-    GString *catlitstr         = S57_getAttVal(geo, "CATLIT");
     char     catlit[LISTSIZE]  = {'\0'};
+    int      ncatlit           = S57_getAttValL(geo, S57_ATT_CATLIT, catlit);
     int      flare_at_45       = FALSE;
     int      extend_arc_radius = TRUE;
-    GString *sectr1str         = NULL;
-    GString *sectr2str         = NULL;
+    gboolean hasSectr          = FALSE;
     double   sectr1            = 0.0;
     double   sectr2            = 0.0;
-    GString *colourstr         = NULL;
     char     colist[LISTSIZE]  = {'\0'};   // colour list
     GString *orientstr         = NULL;
     double   sweep             = 0.0;
@@ -1269,9 +1461,7 @@ static GString *LIGHTS05 (S57_geo *geo)
     // NOTE: valmnr is only use when rendering
     //valnmr = (NULL == valnmrstr) ? 9.0 : S52_atof(valnmrstr->str);
 
-    if ( NULL != catlitstr) {
-        _parseList(catlitstr->str, catlit);
-
+    if (0 < ncatlit) {
         // FIXME: OR vs AND/OR
         if (_strpbrk(catlit, "\010\013")) {
             g_string_append(lights05, ";SY(LIGHTS82)");
@@ -1299,20 +1489,15 @@ static GString *LIGHTS05 (S57_geo *geo)
     }
 
     // Continuation A
-    colourstr = S57_getAttVal(geo, "COLOUR");
-    if (NULL != colourstr)
-        _parseList(colourstr->str, colist);
-    else {
+    if (0 == S57_getAttValL(geo, S57_ATT_COLOUR, colist)) {
         colist[0] = '\014';  // maganta (12)
         colist[1] = '\000';
     }
 
-    sectr1str = S57_getAttVal(geo, "SECTR1");
-    sectr1    = (NULL == sectr1str) ? 0.0 : S52_atof(sectr1str->str);
-    sectr2str = S57_getAttVal(geo, "SECTR2");
-    sectr2    = (NULL == sectr2str) ? 0.0 : S52_atof(sectr2str->str);
+    hasSectr  = S57_getAttValD(geo, S57_ATT_SECTR1, &sectr1);
+    hasSectr &= S57_getAttValD(geo, S57_ATT_SECTR2, &sectr2);
 
-    if (NULL==sectr1str || NULL==sectr2str) {
+    if (FALSE == hasSectr) {
         // not a sector light
 
         //flare_at_45 = _setPtPos(geo, LIGHTLIST);
@@ -1357,7 +1542,7 @@ static GString *LIGHTS05 (S57_geo *geo)
     }
 
     // Continuation B --sector light
-    if (NULL == sectr1str) {
+    if (FALSE == hasSectr) {
         sectr1 = 0.0;
         sectr2 = 0.0;
     } else
@@ -1463,12 +1648,11 @@ static GString *LIGHTS05 (S57_geo *geo)
 
 static GString *LIGHTS06 (S57_geo *geo)
 {
-    static int silent = FALSE;
+    static volatile gint silent = FALSE;
 
-    if (FALSE == silent) {
+    if (TRUE == g_atomic_int_compare_and_exchange(&silent, FALSE, TRUE)) {
         PRINTF("FIXME: CS(LIGHTS06) --> CS(LIGHTS05)\n");
         PRINTF("       (this msg will not repeat)\n");
-        silent = TRUE;
     }
 
     return LIGHTS05(geo);
@@ -1486,12 +1670,12 @@ static GString *_LITDSN01(S57_geo *geo)
 {
     GString *litdsn01         = g_string_new("");
     GString *gstr             = NULL;  // tmp
-    GString *catlitstr        = S57_getAttVal(geo, "CATLIT");
     char     catlit[LISTSIZE] = {'\0'};
+    int      ncatlit          = S57_getAttValL(geo, S57_ATT_CATLIT, catlit);
     GString *litchrstr        = S57_getAttVal(geo, "LITCHR");
     char     litchr[LISTSIZE] = {'\0'};
-    GString *colourstr        = S57_getAttVal(geo, "COLOUR");
     char     colour[LISTSIZE] = {'\0'};
+    int      ncolor           = S57_getAttValL(geo, S57_ATT_COLOUR, colour);
     GString *statusstr        = S57_getAttVal(geo, "STATUS");
     char     status[LISTSIZE] = {'\0'};
 
@@ -1506,15 +1690,12 @@ static GString *_LITDSN01(S57_geo *geo)
 
 
     // CATLIT
-    if (NULL != catlitstr) {
+    if (0 < ncatlit) {
         const char *tmp     = NULL;
         int         i       = 0;
-        int         ncatlit = 0;
-
-        ncatlit = _parseList(catlitstr->str, catlit);
 
-        //if (1 < _parseList(catlitstr->str, catlit))
-        //    PRINTF("WARNING: more then one 'category of light' (CATLIT), other not displayed (%s)\n", catlitstr->str);
+        //if (1 < ncatlit)
+        //    PRINTF("WARNING: more then one 'category of light' (CATLIT), other not displayed\n");
 
         while (i < ncatlit) {
             switch (catlit[i]) {
@@ -1658,12 +1839,11 @@ static GString *_LITDSN01(S57_geo *geo)
     }
 
     // COLOUR,
-    if (NULL != colourstr) {
+    if (0 < ncolor) {
         const char *tmp = NULL;
 
-        //if (1 < _parseList(colourstr->str, colour))
+        //if (1 < ncolor)
         //    PRINTF("WARNING: more then one 'colour' (COLOUR), other not displayed\n");
-        int ncolor = _parseList(colourstr->str, colour);
         for (int i=0; i<ncolor; ++i) {
             switch (colour[0]) {
                 //1: white   IP 11.1;    450.2-3;
@@ -1814,7 +1994,6 @@ static GString *OBSTRN04 (S57_geo *geo)
     GString *obstrn04str = g_string_new("");
     GString *sndfrm02str = NULL;
     GString *udwhaz03str = NULL;
-    GString *valsoustr   = S57_getAttVal(geo, "VALSOU");
     double   valsou      = UNKNOWN;
     double   depth_value = UNKNOWN;
     double   least_depth = UNKNOWN;
@@ -1825,8 +2004,7 @@ static GString *OBSTRN04 (S57_geo *geo)
     //    PRINTF("%s\n",FIDNstr->str);
     //}
 
-    if (NULL != valsoustr) {
-        valsou      = S52_atof(valsoustr->str);
+    if (TRUE == S57_getAttValD(geo, S57_ATT_VALSOU, &valsou)) {
         depth_value = valsou;
         sndfrm02str = _SNDFRM02(geo, depth_value);
     } else {
@@ -2091,12 +2269,11 @@ static GString *OBSTRN04 (S57_geo *geo)
 
 static GString *OBSTRN05 (S57_geo *geo)
 {
-    static int silent = FALSE;
+    static volatile gint silent = FALSE;
 
-    if (FALSE == silent) {
+    if (TRUE == g_atomic_int_compare_and_exchange(&silent, FALSE, TRUE)) {
         PRINTF("FIXME: CS(OBSTRN05) --> CS(OBSTRN04)\n");
         PRINTF("       (this msg will not repeat)\n");
-        silent = TRUE;
     }
 
     return OBSTRN04(geo);
@@ -2104,12 +2281,11 @@ static GString *OBSTRN05 (S57_geo *geo)
 
 static GString *OBSTRN06 (S57_geo *geo)
 {
-    static int silent = FALSE;
+    static volatile gint silent = FALSE;
 
-    if (FALSE == silent) {
+    if (TRUE == g_atomic_int_compare_and_exchange(&silent, FALSE, TRUE)) {
         PRINTF("FIXME: CS(OBSTRN06) --> CS(OBSTRN04)\n");
         PRINTF("       (this msg will not repeat)\n");
-        silent = TRUE;
     }
 
     return OBSTRN04(geo);
@@ -2400,10 +2576,10 @@ static GString *SLCONS03 (S57_geo *geo)
 
     if (S57_AREAS_T == S57_getObjtype(geo)) {
         GString    *seabed01  = NULL;
-        GString    *drval1str = S57_getAttVal(geo, "DRVAL1");
-        double      drval1    = (NULL == drval1str)? -UNKNOWN : S52_atof(drval1str->str);
-        GString    *drval2str = S57_getAttVal(geo, "DRVAL2");
-        double      drval2    = (NULL == drval2str)? -UNKNOWN : S52_atof(drval2str->str);
+        double      drval1    = -UNKNOWN;
+        double      drval2    = -UNKNOWN;
+        S57_getAttValD(geo, S57_ATT_DRVAL1, &drval1);
+        S57_getAttValD(geo, S57_ATT_DRVAL2, &drval2);
         // NOTE: change sign of infinity (minus) to get out of bound in seabed01
 
         double datum = S52_MP_get(S52_MAR_DATUM_OFFSET);
@@ -2589,12 +2765,11 @@ static GString *RESARE02 (S57_geo *geo)
 
 static GString *RESARE03 (S57_geo *geo)
 {
-    static int silent = FALSE;
+    static volatile gint silent = FALSE;
 
-    if (FALSE == silent) {
+    if (TRUE == g_atomic_int_compare_and_exchange(&silent, FALSE, TRUE)) {
         PRINTF("FIXME: CS(RESARE03) --> CS(RESARE02)\n");
         PRINTF("       (this msg will not repeat)\n");
-        silent = TRUE;
     }
 
     return RESARE02(geo);
@@ -3089,11 +3264,10 @@ static GString *_UDWHAZ03(S57_geo *geo, double depth_value)
         //while (NULL != (geoTmp = S57_nextObj(geoTmp))) {
 
             if (S57_LINES_T == S57_getObjtype(geoTmp)) {
-                GString *drval2str = S57_getAttVal(geoTmp, "DRVAL2");
                 //double   drval2    = (NULL == drval2str) ? 0.0 : S52_atof(drval2str->str);
-                double   drval2    = (NULL == drval2str) ? UNKNOWN : S52_atof(drval2str->str);
+                double   drval2    = UNKNOWN;
 
-                if (NULL == drval2str)
+                if (FALSE == S57_getAttValD(geoTmp, S57_ATT_DRVAL2, &drval2))
                     return NULL;
 
                 double datum = S52_MP_get(S52_MAR_DATUM_OFFSET);
@@ -3106,11 +3280,10 @@ static GString *_UDWHAZ03(S57_geo *geo, double depth_value)
 
             } else {
                 // area DEPARE or DRGARE
-                GString *drval1str = S57_getAttVal(geoTmp, "DRVAL1");
                 //double   drval1    = (NULL == drval1str) ? 0.0 : S52_atof(drval1str->str);
-                double   drval1    = (NULL == drval1str) ? UNKNOWN : S52_atof(drval1str->str);
+                double   drval1    = UNKNOWN;
 
-                if (NULL == drval1str)
+                if (FALSE == S57_getAttValD(geoTmp, S57_ATT_DRVAL1, &drval1))
                     return NULL;
 
                 double datum = S52_MP_get(S52_MAR_DATUM_OFFSET);
@@ -3262,12 +3435,11 @@ static GString *VESSEL01 (S57_geo *geo)
 
 static GString *VESSEL02 (S57_geo *geo)
 {
-    static int silent = FALSE;
+    static volatile gint silent = FALSE;
 
-    if (FALSE == silent) {
+    if (TRUE == g_atomic_int_compare_and_exchange(&silent, FALSE, TRUE)) {
         PRINTF("FIXME: CS(VESSEL02) --> CS(VESSEL01)\n");
         PRINTF("       (this msg will not repeat)\n");
-        silent = TRUE;
     }
 
     return VESSEL01(geo);
@@ -3307,12 +3479,11 @@ static GString *VRMEBL01 (S57_geo *geo)
 
 static GString *VRMEBL02 (S57_geo *geo)
 {
-    static int silent = FALSE;
+    static volatile gint silent = FALSE;
 
-    if (FALSE == silent) {
+    if (TRUE == g_atomic_int_compare_and_exchange(&silent, FALSE, TRUE)) {
         PRINTF("FIXME: CS(VRMEBL02) --> CS(VRMEBL01)\n");
         PRINTF("       (this msg will not repeat)\n");
-        silent = TRUE;
     }
 
     return VRMEBL01(geo);
@@ -3331,7 +3502,6 @@ static GString *WRECKS02 (S57_geo *geo)
     GString *quapnt01str = NULL;
     double   least_depth = UNKNOWN;
     double   depth_value = UNKNOWN;
-    GString *valsoustr   = S57_getAttVal(geo, "VALSOU");
     double   valsou      = UNKNOWN;
 
     // debug
@@ -3345,8 +3515,7 @@ static GString *WRECKS02 (S57_geo *geo)
     //}
 
 
-    if (NULL != valsoustr) {
-        valsou      = S52_atof(valsoustr->str);
+    if (TRUE == S57_getAttValD(geo, S57_ATT_VALSOU, &valsou)) {
         depth_value = valsou;
         sndfrm02str = _SNDFRM02(geo, depth_value);
     } else {
@@ -3561,12 +3730,11 @@ static GString *WRECKS02 (S57_geo *geo)
 
 static GString *WRECKS03 (S57_geo *geo)
 {
-    static int silent = FALSE;
+    static volatile gint silent = FALSE;
 
-    if (FALSE == silent) {
+    if (TRUE == g_atomic_int_compare_and_exchange(&silent, FALSE, TRUE)) {
         PRINTF("FIXME: CS(WRECKS03) --> CS(WRECKS02)\n");
         PRINTF("       (this msg will not repeat)\n");
-        silent = TRUE;
     }
 
     return WRECKS02(geo);
@@ -3574,12 +3742,11 @@ static GString *WRECKS03 (S57_geo *geo)
 
 static GString *WRECKS04 (S57_geo *geo)
 {
-    static int silent = FALSE;
+    static volatile gint silent = FALSE;
 
-    if (FALSE == silent) {
+    if (TRUE == g_atomic_int_compare_and_exchange(&silent, FALSE, TRUE)) {
         PRINTF("FIXME: CS(WRECKS04) --> CS(WRECKS02)\n");
         PRINTF("       (this msg will not repeat)\n");
-        silent = TRUE;
     }
 
     return WRECKS02(geo);
@@ -3587,12 +3754,11 @@ static GString *WRECKS04 (S57_geo *geo)
 
 static GString *WRECKS05 (S57_geo *geo)
 {
-    static int silent = FALSE;
+    static volatile gint silent = FALSE;
 
-    if (FALSE == silent) {
+    if (TRUE == g_atomic_int_compare_and_exchange(&silent, FALSE, TRUE)) {
         PRINTF("FIXME: CS(WRECKS05) --> CS(WRECKS02)\n");
         PRINTF("       (this msg will not repeat)\n");
-        silent = TRUE;
     }
 
     return WRECKS02(geo);
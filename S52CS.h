@@ -51,5 +51,7 @@ localObj   *S52_CS_init ();
 localObj   *S52_CS_done (localObj *local);
 int         S52_CS_add  (localObj *local, S57_geo *geo);
 int         S52_CS_touch(localObj *local, S57_geo *geo);
+// debug - report candidate tested by S52_CS_touch() vs a full scan
+int         S52_CS_statTouch(localObj *local);
 
 #endif //_S52CS_H_
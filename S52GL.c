@@ -75,10 +75,14 @@ static double       _centerLon = 0.0;
 static double       _SCAMIN    = 1.0;  // screen scale
 static double       _scalex    = 1.0;  // meter per pixel in X
 static double       _scaley    = 1.0;  // meter per pixel in Y
+static guint        _lodCrnt   = 0;    // level of detail of LINES / AREAS at this scale
 
 // projected view
 static projUV _pmin = { INFINITY,  INFINITY};
 static projUV _pmax = {-INFINITY, -INFINITY};
+// GPU origin - center of view (PRJ), vertex sent to GPU are relative to it so that
+// float keep sub-meter precision far from the projection center (GL1 is double, stay 0)
+static projUV _prjOrig = {0.0, 0.0};
 // _pmin, _pmax convert to GEO for culling object with there extent is in deg
 static projUV _gmin = { INFINITY,  INFINITY};
 static projUV _gmax = {-INFINITY, -INFINITY};
@@ -103,6 +107,10 @@ typedef enum _VP {
 //#define Z_CLIP_PLANE (S57_OVERLAP_GEO_Z + 1)
 #define Z_CLIP_PLANE (S57_OVERLAP_GEO_Z - 1)
 
+// centroid of area clipped by the view are recomputed when the view
+// move by more than this fraction of its size
+#define CENTROID_VIEW_MOVE  0.1
+
 ////////////////////////////////////////////////////////////////////
 
 #define S52_MAX_FONT  4
@@ -122,6 +130,20 @@ static int            _fb_format      = _RGBA;
 //static int            _fb_format      = _RGB ;  // NOTE: on TEGRA2 RGB (3) very slow
 #endif
 
+// dump of FB to file (S52_GL_dumpS57IDPixels()) - GL3 read pixels in a PBO,
+// resolved one frame later, the encoding (PNG, GeoTIFF, ..) is done in a worker thread
+typedef struct _dumpJob {
+    gchar  *fname;
+    guint   w, h;
+    guint   nc;             // number of component (RGB:3, RGBA:4)
+    guint8 *pixels;         // bottom-up (GL)
+    int     ret;
+} _dumpJob;
+static GThreadPool   *_dumpPool = NULL;  // encoder
+static GAsyncQueue   *_dumpDone = NULL;  // job encoded, to free in main thread
+static guint          _dumpNbr  = 0;     // job in the encoder
+static int            _dumpReap(int wait);
+
 typedef struct  pt3  { double   x,y,z; } pt3;
 typedef struct  pt3v { vertex_t x,y,z; } pt3v;
 
@@ -135,6 +157,7 @@ static double _dotpitch_mm_y = 0.3;  // will be overwright at init()
 static int _GL_OES_texture_npot = FALSE;
 static int _GL_EXT_debug_marker = FALSE;
 static int _GL_OES_point_sprite = FALSE;
+static int _GL_EXT_multi_draw_indirect = FALSE;
 
 /////////////////////////////////////////////////////
 //
@@ -153,10 +176,40 @@ static int _GL_OES_point_sprite = FALSE;
 #if defined(S52_USE_GL1) && defined(S52_USE_GL2)
 #error "GL1 or GL2, not both"
 #endif
+#if defined(S52_USE_GL3) && !defined(S52_USE_GL2)
+#error "GL3 extend the GL2 code path, define S52_USE_GL2 or S52_USE_GLES2 also"
+#endif
 #if !defined(S52_USE_GL1) && !defined(S52_USE_GL2)
 #error "must define GL1 or GL2"
 #endif
 
+// dirty rectangle - drawLast() restore from the FB texture only the area of the mariner obj
+// that change, then redraw the obj that overlap it (S52_MAR_DISP_DIRTY_RECT)
+// Note: the back buffer must survive the swap (ex: EGL_BUFFER_PRESERVED)
+typedef struct _dirtyBox {
+    S52_obj *obj;
+    double   x1, y1, x2, y2;   // window extent (pixel) of obj, empty if x1 > x2
+    int      redraw;           // prev: obj overlap a restored area, crnt: obj drawn
+} _dirtyBox;
+static GHashTable *_dirtyObj  = NULL;   // obj that change since the previous drawLast()
+static int         _dirtyAll  = TRUE;   // restore all the view at next drawLast()
+static int         _dirtyFull = TRUE;   // all the view restored this frame
+static int         _dirtyOn   = FALSE;  // measure window extent of obj (cycle LAST)
+#ifdef S52_USE_GL2
+static GArray     *_dirtyPrev = NULL;   // _dirtyBox of obj drawn by the previous drawLast()
+static GArray     *_dirtyCrnt = NULL;   // _dirtyBox of obj drawn by this drawLast()
+static GArray     *_dirtyRest = NULL;   // _dirtyBox (obj NULL) of area restored this frame
+static GHashTable *_dirtyIdx  = NULL;   // obj --> index+1 in _dirtyPrev
+static guint       _nDirtyPx  = 0;      // statistic - pixels restored this frame
+#ifdef S52_DEBUG
+#define DIRTY_STAT_N 100                // drawLast() - report the restored pixels every N frame
+static guint       _dirtyStatN    = 0;  // statistic - frame since last report
+static guint       _dirtyStatFull = 0;  // statistic - frame fully restored since last report
+static double      _dirtyStatPx   = 0.0;// statistic - pixels restored since last report
+#endif
+#endif
+#define DIRTY_PAD  8.0                  // pixel - line width, AA, point size
+
 #define MM2INCH  25.4
 #define PICA      0.351  // mm
 
@@ -170,7 +223,7 @@ static int _GL_OES_point_sprite = FALSE;
 #include "_GL2.i"
 #endif
 
-// GL3.x, GLES3.x - in a day
+// GL3.x, GLES3.x - on top of GL2 (VAO, UBO, instancing)
 #ifdef S52_USE_GL3
 #include "_GL3.i"
 #endif
@@ -180,6 +233,41 @@ static int _GL_OES_point_sprite = FALSE;
 #include "_VULKAN.i"
 #endif
 
+#ifdef S52_USE_GL2
+// tile cache - static chart rendered to texture tiles (S52_MAR_DISP_TILE_CACHE)
+// tile are anchored at the PRJ origin so panning at the same scale reuse them
+#define S52_TILE_PX  256                       // tile size (pixel)
+typedef struct _tile_key {
+    double  scalex;                            // zoom - tile reused only at the same MPP
+    double  scaley;
+    gint64  x;                                 // tile index from PRJ origin
+    gint64  y;
+    guint   settings;                          // hash of Mariners' Param (palette, ..)
+} _tile_key;
+typedef struct _tile_t {
+    _tile_key key;
+    guint     texID;
+    int       valid;                           // FALSE - need rendering
+    guint     lastUsed;                        // frame number (LRU)
+} _tile_t;
+static GHashTable *_tileCache   = NULL;        // _tile_key* --> _tile_t* (key in value)
+static GPtrArray  *_tileView    = NULL;        // tiles of the current view
+static guint       _tileFBO     = 0;
+static guint       _tileFrame   = 0;
+static guint       _tileIdx     = 0;           // next tile of _tileView to check
+static _tile_t    *_tileCrnt    = NULL;        // tile being rendered (render target)
+static int         _tileFlush   = FALSE;       // TRUE - flush all tiles at next DRAW
+static GHashTable *_tileDirtyObj = NULL;       // mariner obj (layer 0-8) that change since the last DRAW
+static GArray     *_tileDirtyExt = NULL;       // double - PRJ extent (x1,y1,x2,y2) of those obj, tiles over it are redrawn
+static projUV      _tileSave_pmin, _tileSave_pmax, _tileSave_gmin, _tileSave_gmax;
+static projUV      _tileScr_pmin,  _tileScr_pmax,  _tileScr_gmin,  _tileScr_gmax;   // screen view
+static projUV      _tilePad_gmin,  _tilePad_gmax; // tile being rendered + 1 tile each side (symbol, text reach)
+                                               // (view is the union of the tiles between tileBegin/End)
+static vp_t        _tileSave_vp;
+static guint       _nTileHit    = 0;           // stat
+static guint       _nTileMiss   = 0;
+#endif  // S52_USE_GL2
+
 
 ///////////////////////////////////////////////////////////////////
 //
@@ -187,11 +275,13 @@ static int _GL_OES_point_sprite = FALSE;
 //
 static guint   _nobj   = 0;     // number of object drawn during lap
 static guint   _ncmd   = 0;     // number of command drawn during lap
-static guint   _oclip  = 0;     // number of object clipped
 static guint   _nFrag  = 0;     // number of pixel fragment (color switch)
 static int     _drgare = 0;     // DRGARE
 static int     _depare = 0;     // DEPARE
 static int     _nAC    = 0;     // total AC (Area Color)
+static guint   _nState = 0;     // number of GL state change (command type, width/style, color or VBO/texture)
+static guint64 _stateLast = 0;  // state of the last command drawn
+static guint   _nLODsaved = 0;  // number of coords of LINES / AREAS saved by the level of detail
 
 // debug
 //static int   _debug  = 0;
@@ -249,7 +339,7 @@ static GLuint   _vboIDaftglwColrID = 0;
 #endif
 
 // experimental
-static vertex_t _hazardZone[5*3];
+static double   _hazardZone[5*3];
 
 static
 inline void      _checkError(const char *msg)
@@ -506,6 +596,69 @@ static int       _getCentroidClose(guint npt, double *ppt)
     return FALSE;
 }
 
+static int       _clipIn(pt3 *p, int axis, double lim, int gt)
+{
+    double c = (0 == axis) ? p->x : p->y;
+
+    return (TRUE == gt) ? (c >= lim) : (c <= lim);
+}
+
+static int       _clipEdge(GArray *in, GArray *out, int axis, double lim, int gt)
+// Sutherland-Hodgman - clip open poly 'in' by one side of the view (axis 0: x, 1: y)
+{
+    g_array_set_size(out, 0);
+
+    if (0 == in->len)
+        return FALSE;
+
+    pt3 *v = (pt3 *)in->data;
+    pt3  s = v[in->len - 1];
+    for (guint i=0; i<in->len; ++i) {
+        pt3 e   = v[i];
+        int inE = _clipIn(&e, axis, lim, gt);
+        int inS = _clipIn(&s, axis, lim, gt);
+
+        // crossing - add intersection
+        if (inE != inS) {
+            double t = (0 == axis) ? (lim - s.x) / (e.x - s.x) : (lim - s.y) / (e.y - s.y);
+            pt3    p = {s.x + t * (e.x - s.x), s.y + t * (e.y - s.y), 0.0};
+            g_array_append_val(out, p);
+        }
+        if (TRUE == inE)
+            g_array_append_val(out, e);
+
+        s = e;
+    }
+
+    return TRUE;
+}
+
+static int       _getCentroidClip(guint npt, double *ppt)
+// clip close poly to the view (convex window, no libtess) then centroid of what is left
+// Note: area cut in many piece by the view give one poly - its centroid might be outside
+{
+    if (npt < 4)
+        return FALSE;
+
+    // skip last pt (same as first)
+    g_array_set_size(_clipA, 0);
+    g_array_append_vals(_clipA, ppt, npt-1);
+
+    _clipEdge(_clipA, _clipB, 0, _pmin.u, TRUE );
+    _clipEdge(_clipB, _clipA, 0, _pmax.u, FALSE);
+    _clipEdge(_clipA, _clipB, 1, _pmin.v, TRUE );
+    _clipEdge(_clipB, _clipA, 1, _pmax.v, FALSE);
+
+    // extent overlap the view but not the area
+    if (_clipA->len < 3)
+        return FALSE;
+
+    guint n = _centroids->len;
+    _getCentroidOpen(_clipA->len, (pt3 *)_clipA->data);
+
+    return (n < _centroids->len) ? TRUE : FALSE;
+}
+
 static double    _computeSCAMIN(void)
 
 {
@@ -750,8 +903,13 @@ static GLint     _glMatrixSet(VP vpcoord)
 
     switch (vpcoord) {
         case VP_PRJ:
-            left   = _pmin.u,      right = _pmax.u,
-            bottom = _pmin.v,      top   = _pmax.v,
+#ifdef S52_USE_GL2
+            // moving the view only move the origin - no re-projection / re-upload of geo
+            _prjOrig.u = (_pmin.u + _pmax.u) / 2.0;
+            _prjOrig.v = (_pmin.v + _pmax.v) / 2.0;
+#endif
+            left   = _pmin.u - _prjOrig.u,  right = _pmax.u - _prjOrig.u,
+            bottom = _pmin.v - _prjOrig.v,  top   = _pmax.v - _prjOrig.v,
             znear  = Z_CLIP_PLANE, zfar  = -Z_CLIP_PLANE;
             //PRINTF("DEBUG: set VP_PRJ\n");
             break;
@@ -794,6 +952,9 @@ static GLint     _glMatrixSet(VP vpcoord)
     glUniformMatrix4fv(_uProjection, 1, GL_FALSE, _pjm[_pjmTop]);
     glUniformMatrix4fv(_uModelview,  1, GL_FALSE, _mvm[_mvmTop]);
 #endif
+#ifdef S52_USE_GL3
+    _setFrameUBO_gl3();
+#endif
 
     return TRUE;
 }
@@ -814,10 +975,21 @@ static GLint     _glMatrixDel(VP vpcoord)
     glUniformMatrix4fv(_uProjection, 1, GL_FALSE, _pjm[_pjmTop]);
     glUniformMatrix4fv(_uModelview,  1, GL_FALSE, _mvm[_mvmTop]);
 #endif
+#ifdef S52_USE_GL3
+    _setFrameUBO_gl3();
+#endif
 
     return TRUE;
 }
 
+static void      _glTranslatedPRJ(double x, double y, double z)
+// translate to a PRJ position (absolute) - relative to GPU origin
+{
+    _glTranslated(x - _prjOrig.u, y - _prjOrig.v, z);
+
+    return;
+}
+
 
 //-----------------------------------
 //
@@ -848,8 +1020,9 @@ static int       _win2prj(double *x, double *y)
         return FALSE;
     }
 
-    *x = u;
-    *y = v;
+    // back to absolute
+    *x = u + _prjOrig.u;
+    *y = v + _prjOrig.v;
 
 #else
     GLdouble dummy_z = 0.0;
@@ -873,8 +1046,9 @@ static projXY    _prj2win(projXY p)
         g_assert(0);
         return p;
     }
-    float u = p.u;
-    float v = p.v;
+    // relative to GPU origin, as the matrix
+    float u = p.u - _prjOrig.u;
+    float v = p.v - _prjOrig.v;
     float dummy_z = 0.0;
 
     // make sure that _gluProject() has the right coordinate
@@ -901,6 +1075,130 @@ static projXY    _prj2win(projXY p)
     return p;
 }
 
+#ifdef S52_USE_GL2
+static int       _dirtyAddWin(double x, double y)
+// extend the window extent of the obj being drawn
+{
+    _dirtyBox *b = &g_array_index(_dirtyCrnt, _dirtyBox, _dirtyCrnt->len-1);
+
+    b->x1 = MIN(b->x1, x - DIRTY_PAD);
+    b->y1 = MIN(b->y1, y - DIRTY_PAD);
+    b->x2 = MAX(b->x2, x + DIRTY_PAD);
+    b->y2 = MAX(b->y2, y + DIRTY_PAD);
+
+    return TRUE;
+}
+
+static int       _dirtyPrj2win(GLfloat x, GLfloat y, GLfloat dx, GLfloat dy, const GLfloat *mvm, double *wx, double *wy)
+// vertex x,y (relative to _prjOrig) --> window, as the vertex shader do
+// dx,dy: offset added after the modelview (GL3 instance), mvm: NULL for identity
+{
+    GLfloat in [4] = {x, y, 0.0, 1.0};
+    GLfloat out[4] = {x, y, 0.0, 1.0};
+
+    if (NULL != mvm)
+        __gluMultMatrixVecf(mvm, in, out);
+    out[0] += dx;
+    out[1] += dy;
+    __gluMultMatrixVecf(_pjm[_pjmTop], out, in);
+
+    if (0.0 == in[3])
+        return FALSE;
+
+    *wx = _vp.x + (in[0] / in[3] * 0.5 + 0.5) * _vp.w;
+    *wy = _vp.y + (in[1] / in[3] * 0.5 + 0.5) * _vp.h;
+
+    return TRUE;
+}
+
+static int       _dirtyAddVert(guint npt, const GLfloat *ppt, GLfloat dx, GLfloat dy)
+// extend the window extent of the obj being drawn with npt vertex (x,y,z)
+{
+    double wx, wy;
+    for (guint i=0; i<npt; ++i, ppt+=3) {
+        if (TRUE == _dirtyPrj2win(ppt[0], ppt[1], dx, dy, _mvm[_mvmTop], &wx, &wy))
+            _dirtyAddWin(wx, wy);
+    }
+
+    return TRUE;
+}
+
+static int       _dirtyAddExt(S57_geo *geo)
+// extend the window extent of the obj being drawn with the extent of its geo (AC, AP)
+{
+    double x1, y1, x2, y2;
+    if (FALSE == S57_getExt(geo, &x1, &y1, &x2, &y2))
+        return FALSE;
+
+    double xyz[4*3] = {x1, y1, 0.0,  x1, y2, 0.0,  x2, y2, 0.0,  x2, y1, 0.0};
+    if (FALSE == S57_geo2prj3dv(4, xyz))
+        return FALSE;
+
+    double wx, wy;
+    for (int i=0; i<4; ++i) {
+        if (TRUE == _dirtyPrj2win(xyz[i*3+0] - _prjOrig.u, xyz[i*3+1] - _prjOrig.v, 0.0, 0.0, NULL, &wx, &wy))
+            _dirtyAddWin(wx, wy);
+    }
+
+    return TRUE;
+}
+
+static int       _dirtyIntersec(_dirtyBox *A, _dirtyBox *B)
+{
+    if ((A->x1 > A->x2) || (B->x1 > B->x2))
+        return FALSE;
+
+    return !((A->x2 < B->x1) || (B->x2 < A->x1) || (A->y2 < B->y1) || (B->y2 < A->y1));
+}
+
+static int       _dirtyAddRest(_dirtyBox *b)
+// add the area of b to the area to restore, merge overlapping area
+{
+    if (b->x1 > b->x2)
+        return FALSE;
+
+    _dirtyBox r = {NULL, b->x1, b->y1, b->x2, b->y2, TRUE};
+
+    guint i = 0;
+    while (i < _dirtyRest->len) {
+        _dirtyBox *o = &g_array_index(_dirtyRest, _dirtyBox, i);
+        if (TRUE == _dirtyIntersec(&r, o)) {
+            r.x1 = MIN(r.x1, o->x1);
+            r.y1 = MIN(r.y1, o->y1);
+            r.x2 = MAX(r.x2, o->x2);
+            r.y2 = MAX(r.y2, o->y2);
+            g_array_remove_index_fast(_dirtyRest, i);
+            i = 0;
+        } else {
+            ++i;
+        }
+    }
+    g_array_append_val(_dirtyRest, r);
+
+    return TRUE;
+}
+#endif  // S52_USE_GL2
+
+static int       _dirtyBeg(S52_obj *obj)
+// start the window extent of obj, text extend the extent of the obj allready drawn
+{
+#ifdef S52_USE_GL2
+    if (0 < _dirtyCrnt->len) {
+        _dirtyBox *b = &g_array_index(_dirtyCrnt, _dirtyBox, _dirtyCrnt->len-1);
+        if (obj == b->obj)
+            return TRUE;
+    }
+
+    // redraw: drawn by this drawLast()
+    _dirtyBox b = {obj, G_MAXDOUBLE, G_MAXDOUBLE, -G_MAXDOUBLE, -G_MAXDOUBLE, TRUE};
+    g_array_append_val(_dirtyCrnt, b);
+#else
+    (void)obj;
+#endif
+
+    return TRUE;
+}
+
 static int       _doProjection(vp_t vp, double centerLat, double centerLon, double rangeDeg)
 {
     pt3 NE = {0.0, 0.0, 0.0};  // Nort/East
@@ -990,6 +1288,244 @@ int        S52_GL_prj2win(double *x, double *y)
     return TRUE;
 }
 
+///////////////////////////////////////////////////////////////////
+//
+// declutter - screen-space occupancy grid (S52_MAR_DISP_DECLUTTER)
+//
+// text (and point symbol) are placed in display priority order,
+// anything that hit an item allready placed is dropped
+// Note: grid and placement are kept from frame to frame while the view is stable
+
+#define DCLT_CELL_PX    8       // grid cell size (pixel)
+#define DCLT_MAX_LABEL 32       // label per object that have a cached placement
+
+typedef struct _dclt_t {
+    guint32 txtTested;          // one bit per label (TX/TE, segment, ..) of this object
+    guint32 txtPlaced;
+    guint   symTested;
+    guint   symPlaced;
+} _dclt_t;
+
+static guchar     *_dclt_grid    = NULL;    // one byte per cell, 0 - free
+static guint       _dclt_gridW   = 0;
+static guint       _dclt_gridH   = 0;
+static GHashTable *_dclt_cache   = NULL;    // S52_obj* --> _dclt_t
+static int         _dclt_valid   = FALSE;   // FALSE - flush grid & cache at next DRAW
+static S52_obj    *_dclt_crntObj = NULL;    // to number the labels of an object
+static guint       _dclt_crntIdx = 0;
+static projUV      _dclt_pmin    = {0.0, 0.0};
+static projUV      _dclt_pmax    = {0.0, 0.0};
+static double      _dclt_north   = 0.0;
+static vp_t        _dclt_vp      = {0, 0, 0, 0};
+static guint       _nDclt        = 0;       // stat: item dropped in this frame
+
+static int       _dclt_begin(void)
+// start of DRAW - keep grid & cached placement if the view didn't change
+{
+    _dclt_crntObj = NULL;
+    _dclt_crntIdx = 0;
+    _nDclt        = 0;
+
+    if (0.0 == S52_MP_get(S52_MAR_DISP_DECLUTTER))
+        return TRUE;
+
+    if (NULL == _dclt_cache)
+        _dclt_cache = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, g_free);
+
+    if ((TRUE          == _dclt_valid  ) &&
+        (_pmin.u       == _dclt_pmin.u ) && (_pmin.v == _dclt_pmin.v) &&
+        (_pmax.u       == _dclt_pmax.u ) && (_pmax.v == _dclt_pmax.v) &&
+        (_north        == _dclt_north  ) &&
+        (0 == memcmp(&_vp, &_dclt_vp, sizeof(vp_t)))
+       )
+        return TRUE;
+
+    // new view - start over
+    guint w = _vp.w / DCLT_CELL_PX + 1;
+    guint h = _vp.h / DCLT_CELL_PX + 1;
+    if ((w != _dclt_gridW) || (h != _dclt_gridH)) {
+        g_free(_dclt_grid);
+        _dclt_grid  = g_new(guchar, w * h);
+        _dclt_gridW = w;
+        _dclt_gridH = h;
+    }
+    memset(_dclt_grid, 0, _dclt_gridW * _dclt_gridH);
+    g_hash_table_remove_all(_dclt_cache);
+
+    _dclt_pmin  = _pmin;
+    _dclt_pmax  = _pmax;
+    _dclt_north = _north;
+    _dclt_vp    = _vp;
+    _dclt_valid = TRUE;
+
+    return TRUE;
+}
+
+static int       _dclt_hit(double x1, double y1, double x2, double y2)
+// TRUE if the window rect (pixel, relative to viewport) hit an item allready placed
+// if not, mark the rect as taken
+{
+    int c1 = MAX(0, (int)floor(x1) / DCLT_CELL_PX);
+    int r1 = MAX(0, (int)floor(y1) / DCLT_CELL_PX);
+    int c2 = MIN((int)_dclt_gridW - 1, (int)floor(x2) / DCLT_CELL_PX);
+    int r2 = MIN((int)_dclt_gridH - 1, (int)floor(y2) / DCLT_CELL_PX);
+
+    // outside view - nothing to collide with
+    if (c1>c2 || r1>r2)
+        return FALSE;
+
+    for (int r=r1; r<=r2; ++r) {
+        guchar *cell = _dclt_grid + r*_dclt_gridW;
+        for (int c=c1; c<=c2; ++c) {
+            if (0 != cell[c])
+                return TRUE;
+        }
+    }
+
+    for (int r=r1; r<=r2; ++r)
+        memset(_dclt_grid + r*_dclt_gridW + c1, 1, c2 - c1 + 1);
+
+    return FALSE;
+}
+
+static int       _dclt_place(S52_obj *obj, int isSY, double x, double y, double x1, double y1, double x2, double y2)
+// x,y anchor (PRJ), x1,y1,x2,y2 rect (pixel) relative to the anchor
+// return TRUE if the item is to be drawn
+{
+    if ((NULL==obj) || (S52_GL_DRAW!=_crnt_GL_cycle) || (NULL==_dclt_grid))
+        return TRUE;
+
+    if (0.0 == S52_MP_get(S52_MAR_DISP_DECLUTTER))
+        return TRUE;
+
+#ifdef S52_USE_GL2
+    // tile are shared by many view - no declutter
+    if (NULL != _tileCrnt)
+        return TRUE;
+#endif
+
+    // label index of this object in this frame
+    guint32 bit = 0;
+    if (FALSE == isSY) {
+        if (obj != _dclt_crntObj) {
+            _dclt_crntObj = obj;
+            _dclt_crntIdx = 0;
+        }
+        bit = (_dclt_crntIdx < DCLT_MAX_LABEL) ? (1u << _dclt_crntIdx) : 0;
+        ++_dclt_crntIdx;
+    }
+
+    _dclt_t *dclt = (_dclt_t *)g_hash_table_lookup(_dclt_cache, obj);
+    if (NULL == dclt) {
+        dclt = g_new0(_dclt_t, 1);
+        g_hash_table_insert(_dclt_cache, obj, dclt);
+    }
+
+    // same view - reuse last placement
+    if (TRUE == isSY) {
+        if (TRUE == dclt->symTested) {
+            if (FALSE == dclt->symPlaced) ++_nDclt;
+            return dclt->symPlaced;
+        }
+    } else {
+        if (0 != (dclt->txtTested & bit)) {
+            if (0 == (dclt->txtPlaced & bit)) ++_nDclt;
+            return (0 != (dclt->txtPlaced & bit)) ? TRUE : FALSE;
+        }
+    }
+
+    projXY p = {x, y};
+    p = _prj2win(p);
+    p.u -= _vp.x;
+    p.v -= _vp.y;
+
+    int placed = (TRUE == _dclt_hit(p.u + x1, p.v + y1, p.u + x2, p.v + y2)) ? FALSE : TRUE;
+    if (FALSE == placed)
+        ++_nDclt;
+
+    if (TRUE == isSY) {
+        dclt->symTested = TRUE;
+        dclt->symPlaced = placed;
+    } else {
+        // label beyond DCLT_MAX_LABEL are tested every frame
+        dclt->txtTested |= bit;
+        if (TRUE == placed)
+            dclt->txtPlaced |= bit;
+    }
+
+    return placed;
+}
+
+int        S52_GL_declutterSY(S52_obj *obj, gpointer user_data)
+// place point symbol before anything is drawn
+// Note: caller walk obj in decreasing display priority order
+{
+    // quiet compiler
+    (void)user_data;
+
+    if (2.0 != S52_MP_get(S52_MAR_DISP_DECLUTTER))
+        return TRUE;
+
+    S57_geo *geoData = S52_PL_getGeo(obj);
+    if (S57_POINT_T != S57_getObjtype(geoData))
+        return TRUE;
+
+    S52_CmdWrd cmdWrd = S52_PL_iniCmd(obj);
+    while (S52_CMD_NONE != cmdWrd) {
+        if (S52_CMD_SYM_PT == cmdWrd) {
+            guint     npt = 0;
+            GLdouble *ppt = NULL;
+            if (FALSE == S57_getGeoData(geoData, 0, &npt, &ppt))
+                return FALSE;
+
+            int width  = 0;
+            int height = 0;
+            S52_PL_getSYbbox(obj, &width, &height);
+
+            // bbox unit: 0.01 mm - assume pivot at the center
+            double w2 = width  / (200.0 * _dotpitch_mm_x);
+            double h2 = height / (200.0 * _dotpitch_mm_y);
+
+            _dclt_place(obj, TRUE, ppt[0], ppt[1], -w2, -h2, w2, h2);
+
+            // first SY only
+            return TRUE;
+        }
+        cmdWrd = S52_PL_getCmdNext(obj);
+    }
+
+    return TRUE;
+}
+
+int        S52_GL_resetDeclutter(void)
+// something changed other than the view (Mariners' Param, text disp, object deleted, ..)
+{
+    _dclt_valid = FALSE;
+
+    return TRUE;
+}
+
+static int       _dclt_dropSY(S52_obj *obj)
+// TRUE if the point symbol of this obj lost its place
+{
+    if (2.0 != S52_MP_get(S52_MAR_DISP_DECLUTTER))
+        return FALSE;
+
+    if (S52_GL_DRAW!=_crnt_GL_cycle || NULL==_dclt_cache)
+        return FALSE;
+
+#ifdef S52_USE_GL2
+    if (NULL != _tileCrnt)
+        return FALSE;
+#endif
+
+    _dclt_t *dclt = (_dclt_t *)g_hash_table_lookup(_dclt_cache, obj);
+    if ((NULL!=dclt) && (TRUE==dclt->symTested) && (FALSE==dclt->symPlaced))
+        return TRUE;
+
+    return FALSE;
+}
+
 static void      _glLineStipple(GLint  factor,  GLushort  pattern)
 {
 #ifdef S52_USE_GL2
@@ -1032,6 +1568,7 @@ static void      _glPointSize(GLfloat size)
 #ifdef S52_USE_GL2
     //glEnable(GL_VERTEX_PROGRAM_POINT_SIZE);
     //then 'gl_PointSize' in the shader becomme active
+    _shPointSize = size;
     glUniform1f(_uPointSize, size);
 #else
     glPointSize(size);
@@ -1067,6 +1604,9 @@ static GLvoid    _DrawArrays_LINE_STRIP(guint npt, vertex_t *ppt)
     glVertexAttribPointer    (_aPosition, 3, GL_FLOAT, GL_FALSE, 0, ppt);
     glDrawArrays(GL_LINE_STRIP, 0, npt);
     glDisableVertexAttribArray(_aPosition);
+
+    if (TRUE == _dirtyOn)
+        _dirtyAddVert(npt, ppt, 0.0, 0.0);
 #else
     glVertexPointer(3, GL_DBL_FLT, 0, ppt);
     glDrawArrays(GL_LINE_STRIP, 0, npt);
@@ -1098,6 +1638,9 @@ static GLvoid    _DrawArrays_LINES(guint npt, vertex_t *ppt)
     glVertexAttribPointer    (_aPosition, 3, GL_FLOAT, GL_FALSE, 0, ppt);
     glDrawArrays(GL_LINES, 0, npt);
     glDisableVertexAttribArray(_aPosition);
+
+    if (TRUE == _dirtyOn)
+        _dirtyAddVert(npt, ppt, 0.0, 0.0);
 #else
     glVertexPointer(3, GL_DBL_FLT, 0, ppt);
     glDrawArrays(GL_LINES, 0, npt);
@@ -1226,10 +1769,24 @@ static int       _VBODraw_AREA(S57_prim *prim)
     glBindBuffer(GL_ARRAY_BUFFER, vboID);
 
 #ifdef S52_USE_GL2
+    {   // vertex relative to prim origin
+        double ox = 0.0;
+        double oy = 0.0;
+        S57_getPrimOrig(prim, &ox, &oy);
+        glUniform2f(_uOrigin, ox - _prjOrig.u, oy - _prjOrig.v);
+    }
+
+#ifdef S52_USE_GL3
+    // attribute bound in the VAO
+    _VAODraw_gl3(prim, vboID);
+#else
     glEnableVertexAttribArray(_aPosition);
     glVertexAttribPointer(_aPosition, 3, GL_FLOAT, GL_FALSE, 0, 0);
     _VBODrawArrays_AREA(prim);
     glDisableVertexAttribArray(_aPosition);
+#endif
+
+    glUniform2f(_uOrigin, 0.0, 0.0);
 #else
     // set VertPtr to VBO
     glVertexPointer(3, GL_DBL_FLT, 0, 0);
@@ -1407,6 +1964,11 @@ static int       _fillArea(S57_geo *geoData)
     _callDList(prim);
 #endif
 
+#ifdef S52_USE_GL2
+    if (TRUE == _dirtyOn)
+        _dirtyAddExt(geoData);
+#endif
+
     return TRUE;
 }
 
@@ -1480,7 +2042,7 @@ glColor4ub(_cIdx.color.r, _cIdx.color.g, _cIdx.color.b, _cIdx.color.a);
 #endif
 */
 #ifdef S52_USE_GL2
-    glUniform4f(_uColor, r/255.0, g/255.0, b/255.0, (4 - (a - '0')) * TRNSP_FAC_GLES2);
+    _glUniformColor(r/255.0, g/255.0, b/255.0, (4 - (a - '0')) * TRNSP_FAC_GLES2);
 #else
     glColor4ub(r, g, b, (4 - (a - '0')) * TRNSP_FAC);
 #endif
@@ -1604,16 +2166,36 @@ static int       _glCallList(S52_DList *DListData)
                         /*
                         if (mode = GL_LINES) {
                             glLineWidth(col->pen_w - '0' + 1.0);
-                            glUniform4f(_uColor, col->R/255.0, col->G/255.0, col->B/255.0, 0.5);
+                            _glUniformColor(col->R/255.0, col->G/255.0, col->B/255.0, 0.5);
                             glDrawArrays(mode, first, count);
                             glLineWidth(col->pen_w - '0');
-                            glUniform4f(_uColor, col->R/255.0, col->G/255.0, col->B/255.0, (4 - (col->trans - '0')) * TRNSP_FAC_GLES2);
+                            _glUniformColor(col->R/255.0, col->G/255.0, col->B/255.0, (4 - (col->trans - '0')) * TRNSP_FAC_GLES2);
                         }
                         //*/
 
                         // normal draw
+#ifdef S52_USE_GL3
+                        if (0 < _instNbr_gl3)
+                            glDrawArraysInstanced(mode, first, count, _instNbr_gl3);
+                        else
+#endif
                         glDrawArrays(mode, first, count);
 
+#ifdef S52_USE_GL2
+                        if (TRUE == _dirtyOn) {
+                            GArray   *vert = S57_getPrimVertex(DListData->prim[i]);
+                            GLfloat  *v    = ((GLfloat*)vert->data) + first*3;
+#ifdef S52_USE_GL3
+                            for (GLsizei k=0; k<_instNbr_gl3; ++k) {
+                                GLfloat *off = (GLfloat*)_instBuf_gl3->data + k*2;
+                                _dirtyAddVert(count, v, off[0], off[1]);
+                            }
+                            if (0 == _instNbr_gl3)
+#endif
+                            _dirtyAddVert(count, v, 0.0, 0.0);
+                        }
+#endif
+
                         /*
                         { // debug
                             char str[80];
@@ -1664,6 +2246,19 @@ static int       _glCallList(S52_DList *DListData)
     return TRUE;
 }
 
+static int       _saveCentroid(S57_geo *geoData)
+// cache centroids in geo, tag with the view
+{
+    S57_newCentroid(geoData);
+    for (guint i=0; i<_centroids->len; ++i) {
+        pt3 *pt = &g_array_index(_centroids, pt3, i);
+        S57_addCentroid(geoData, pt->x, pt->y);
+    }
+    S57_setCentroidView(geoData, _pmin.u, _pmin.v, _pmax.u, _pmax.v);
+
+    return TRUE;
+}
+
 static int       _computeCentroid(S57_geo *geoData)
 // return centroids
 // fill global array _centroid
@@ -1707,32 +2302,74 @@ static int       _computeCentroid(S57_geo *geoData)
     x2 = xyz[3];
     y2 = xyz[4];
 
-    // extent inside view, compute normal centroid, no clip
+    // extent inside view, centroid is the pole computed at load, no clip
     if ((_pmin.u < x1) && (_pmin.v < y1) && (_pmax.u > x2) && (_pmax.v > y2)) {
         g_array_set_size(_centroids, 0);
 
-        _getCentroidClose(npt, ppt);
+        pt3 pt = {0.0, 0.0, 0.0};
+        if (TRUE == S57_getPole(geoData, &pt.x, &pt.y))
+            g_array_append_val(_centroids, pt);
+        else
+            _getCentroidClose(npt, ppt);
         //PRINTF("no clip: %s\n", S57_getName(geoData));
 
-        return TRUE;
+        return _saveCentroid(geoData);
     }
 
-    // CSG - Computational Solid Geometry  (clip poly)
+    // clipped by the view - reuse the centroids if the view didn't move much
     {
-        _g_ptr_array_clear(_tmpV);
+        double v1, w1, v2, w2;
+        if (TRUE == S57_getCentroidView(geoData, &v1, &w1, &v2, &w2)) {
+            double dx = (_pmax.u - _pmin.u) * CENTROID_VIEW_MOVE;
+            double dy = (_pmax.v - _pmin.v) * CENTROID_VIEW_MOVE;
 
-        g_array_set_size(_centroids, 0);
-        g_array_set_size(_vertexs,   0);
-        g_array_set_size(_nvertex,   0);
+            if ((fabs(v1 - _pmin.u) < dx) && (fabs(v2 - _pmax.u) < dx) &&
+                (fabs(w1 - _pmin.v) < dy) && (fabs(w2 - _pmax.v) < dy)) {
+                double x, y;
 
-        //gluTessProperty(_tcen, GLU_TESS_BOUNDARY_ONLY, GLU_TRUE);
+                g_array_set_size(_centroids, 0);
+                S57_hasCentroid(geoData);  // reset idx
+                while (TRUE == S57_getNextCentroid(geoData, &x, &y)) {
+                    pt3 pt = {x, y, 0.0};
+                    g_array_append_val(_centroids, pt);
+                }
 
-        // debug
-        //PRINTF("npt: %i\n", npt);
+                return TRUE;
+            }
+        }
+    }
 
-        gluTessBeginPolygon(_tcen, NULL);
+    // one centroid - convex window clip
+    if (0.0 == S52_MP_get(S52_MAR_DISP_CENTROIDS)) {
+        g_array_set_size(_centroids, 0);
 
-        // place the area --CW (BUG: should be CCW!)
+        if (FALSE == _getCentroidClip(npt, ppt)) {
+            // concave, centroid outside what is left - use pole if in view
+            pt3 pt = {0.0, 0.0, 0.0};
+            if ((TRUE == S57_getPole(geoData, &pt.x, &pt.y)) &&
+                (_pmin.u < pt.x) && (pt.x < _pmax.u) && (_pmin.v < pt.y) && (pt.y < _pmax.v))
+                g_array_append_val(_centroids, pt);
+        }
+
+        return _saveCentroid(geoData);
+    }
+
+    // all centroids - CSG - Computational Solid Geometry  (clip poly)
+    {
+        _g_ptr_array_clear(_tmpV);
+
+        g_array_set_size(_centroids, 0);
+        g_array_set_size(_vertexs,   0);
+        g_array_set_size(_nvertex,   0);
+
+        //gluTessProperty(_tcen, GLU_TESS_BOUNDARY_ONLY, GLU_TRUE);
+
+        // debug
+        //PRINTF("npt: %i\n", npt);
+
+        gluTessBeginPolygon(_tcen, NULL);
+
+        // place the area --CW (BUG: should be CCW!)
         gluTessBeginContour(_tcen);
         for (guint i=0; i<npt-1; ++i) {
             gluTessVertex(_tcen, (GLdouble*)ppt, (void*)ppt);
@@ -1793,7 +2430,7 @@ static int       _computeCentroid(S57_geo *geoData)
         }
     }
 
-    return TRUE;
+    return _saveCentroid(geoData);
 }
 
 static int       _getVesselVector(S52_obj *obj, double *course, double *speed)
@@ -1842,7 +2479,7 @@ static int       _renderSY_POINT_T(S52_obj *obj, double x, double y, double rota
 
     _glLoadIdentity(GL_MODELVIEW);
 
-    _glTranslated(x, y, 0.0);
+    _glTranslatedPRJ(x, y, 0.0);
     _glScaled(1.0, -1.0, 1.0);
     _pushScaletoPixel(TRUE);
     _glRotated(rotation, 0.0, 0.0, 1.0);    // rotate coord sys. on Z
@@ -1854,6 +2491,76 @@ static int       _renderSY_POINT_T(S52_obj *obj, double x, double y, double rota
     return TRUE;
 }
 
+#ifdef S52_USE_GL3
+static int       _pushSND_gl3(S52_obj *obj, double x, double y)
+// defer a sounding digit to _flushSND_gl3(), FALSE if it has to be drawn now
+{
+    if ((S52_GL_DRAW!=_crnt_GL_cycle) || (TRUE==_dirtyOn) || (TRUE==_doHighlight))
+        return FALSE;
+
+    if ((-1==_aInstOffset) || (NULL==_sndBatch_gl3))
+        return FALSE;
+
+    S52_DList *DListData = S52_PL_getDListData(obj);
+    if (NULL == DListData)
+        return FALSE;
+
+    GArray *off = (GArray *)g_hash_table_lookup(_sndBatch_gl3, DListData);
+    if (NULL == off) {
+        off = g_array_new(FALSE, FALSE, sizeof(GLfloat)*2);
+        g_hash_table_insert(_sndBatch_gl3, DListData, off);
+    }
+    if (0 == off->len)
+        g_ptr_array_add(_sndOrder_gl3, DListData);
+
+    // relative to GPU origin, like the vertex of _glTranslatedPRJ()
+    GLfloat o[2] = {x - _prjOrig.u, y - _prjOrig.v};
+    g_array_append_val(off, o);
+
+    ++_nSnd_gl3;
+
+    return TRUE;
+}
+
+static int       _flushSND_gl3(void)
+// draw the sounding digit of this batch - one instanced call per digit symbol
+{
+    if ((NULL==_sndOrder_gl3) || (0==_sndOrder_gl3->len))
+        return TRUE;
+
+    for (guint i=0; i<_sndOrder_gl3->len; ++i) {
+        S52_DList *DListData = (S52_DList *)g_ptr_array_index(_sndOrder_gl3, i);
+        GArray    *off       = (GArray    *)g_hash_table_lookup(_sndBatch_gl3, DListData);
+
+        g_array_set_size   (_instBuf_gl3, 0);
+        g_array_append_vals(_instBuf_gl3, off->data, off->len);
+        g_array_set_size   (off, 0);
+
+        _instUpload_gl3();
+
+        // same as _renderSY_POINT_T() at the GPU origin, position come from the instance
+        _glLoadIdentity(GL_MODELVIEW);
+        _glScaled(1.0, -1.0, 1.0);
+        _pushScaletoPixel(TRUE);
+        _glRotated(_north, 0.0, 0.0, 1.0);
+
+        _glCallList(DListData);
+
+        _popScaletoPixel();
+
+        _instEnd_gl3();
+
+        ++_nSndCall_gl3;
+    }
+
+    g_ptr_array_set_size(_sndOrder_gl3, 0);
+
+    _checkError("_flushSND_gl3()");
+
+    return TRUE;
+}
+#endif  // S52_USE_GL3
+
 static int       _renderSY_silhoutte(S52_obj *obj)
 // ownship & vessel (AIS)
 {
@@ -1905,7 +2612,7 @@ static int       _renderSY_silhoutte(S52_obj *obj)
         //_glMatrixMode  (GL_MODELVIEW);
         _glLoadIdentity(GL_MODELVIEW);
 
-        _glTranslated(ppt[0], ppt[1], 0.0);
+        _glTranslatedPRJ(ppt[0], ppt[1], 0.0);
         _glScaled(1.0, -1.0, 1.0);
         _glRotated(orient, 0.0, 0.0, 1.0);    // rotate coord sys. on Z
 
@@ -1967,7 +2674,7 @@ static int       _renderSY_CSYMB(S52_obj *obj)
 
         _win2prj(&x, &y);
 
-        _glTranslated(x, y, 0.0);
+        _glTranslatedPRJ(x, y, 0.0);
         _glScaled(1.0, -1.0, 1.0);
         _glRotated(_north, 0.0, 0.0, 1.0);    // rotate coord sys. on Z
 
@@ -2034,7 +2741,7 @@ static int       _renderSY_CSYMB(S52_obj *obj)
 
             _win2prj(&x, &y);
 
-            _glTranslated(x, y, 0.0);
+            _glTranslatedPRJ(x, y, 0.0);
             _glScaled(_scalex / (_dotpitch_mm_x * 100.0),
                       //scaley / (_dotpitch_mm_y * 100.0),
                       _scaley / (_dotpitch_mm_x * 100.0),
@@ -2587,6 +3294,18 @@ static int       _renderSY(S52_obj *obj)
         //    //g_assert(0);
         //}
 
+        // declutter - lost its place to a symbol of higher priority
+        if (TRUE == _dclt_dropSY(obj))
+            return TRUE;
+
+#ifdef S52_USE_GL3
+        // sounding digit - drawn by batch (rotation is only _north)
+        if ((0.0==orient) && (0==g_strcmp0(S57_getName(geoData), "SOUNDG"))) {
+            if (TRUE == _pushSND_gl3(obj, ppt[0], ppt[1]))
+                return TRUE;
+        }
+#endif
+
         // all other point sym
         _renderSY_POINT_T(obj, ppt[0], ppt[1], orient+_north);
 
@@ -2715,24 +3434,9 @@ static int       _renderSY(S52_obj *obj)
             double offset_x;
             double offset_y;
 
-            // corner case where scrolling set area is clipped by view
-            double x1,y1,x2,y2;
-            S57_getExt(geoData, &x1, &y1, &x2, &y2);
-            if ((y1 < _gmin.v) || (y2 > _gmax.v) || (x1 < _gmin.u) || (x2 > _gmax.u)) {
-                // reset centroid
-                S57_newCentroid(geoData);
-            }
-
-            // debug - skip centroid (cost 30% CPU and no glDraw(); from 120ms to 80ms on Estuaire du St-L CA279037.000)
-            if (TRUE == S57_hasCentroid(geoData)) {
-                double x,y;
-                while (TRUE == S57_getNextCentroid(geoData, &x, &y)) {
-                    _renderSY_POINT_T(obj, x, y, orient+_north);
-                }
-                return TRUE;
-            } else {
-                _computeCentroid(geoData);
-            }
+            // centroids are cached in geo - pole when the area is in view, else
+            // recomputed only when the view move (see _computeCentroid())
+            _computeCentroid(geoData);
 
             // compute offset
             if (0 < _centroids->len) {
@@ -2746,8 +3450,6 @@ static int       _renderSY(S52_obj *obj)
                 // scale offset
                 offset_x *= _scalex;
                 offset_y *= _scaley;
-
-                S57_newCentroid(geoData);
             }
 
             for (guint i=0; i<_centroids->len; ++i) {
@@ -2756,9 +3458,6 @@ static int       _renderSY(S52_obj *obj)
                 // debug
                 //PRINTF("drawing centered at: %f/%f\n", pt->x, pt->y);
 
-                // save centroid
-                S57_addCentroid(geoData, pt->x, pt->y);
-
                 // check if offset move the object outside pick region
                 // that symbole 'Y' axis is down, so '-offsety'
                 //_renderSY_POINT_T(obj, pt->x, pt->y, orient+_north);
@@ -2785,8 +3484,10 @@ static int       _renderLS_LIGHTS05(S52_obj *obj)
 {
     S57_geo *geoData   = S52_PL_getGeo(obj);
     GString *orientstr = S57_getAttVal(geoData, "ORIENT");
-    GString *sectr1str = S57_getAttVal(geoData, "SECTR1");
-    GString *sectr2str = S57_getAttVal(geoData, "SECTR2");
+    double   sectr1    = 0.0;
+    double   sectr2    = 0.0;
+    gboolean hasSectr1 = S57_getAttValD(geoData, S57_ATT_SECTR1, &sectr1);
+    gboolean hasSectr2 = S57_getAttValD(geoData, S57_ATT_SECTR2, &sectr2);
     double   leglenpix = 25.0 / S52_MP_get(S52_MAR_DOTPITCH_MM_X);
 
     GLdouble *ppt = NULL;
@@ -2798,12 +3499,11 @@ static int       _renderLS_LIGHTS05(S52_obj *obj)
 
     // this is part of CS
     if (TRUE == (int) S52_MP_get(S52_MAR_FULL_SECTORS)) {
-        GString  *valnmrstr = S57_getAttVal(geoData, "VALNMR");
-        if (NULL != valnmrstr) {
+        double valnmr = 0.0;
+        if (TRUE == S57_getAttValD(geoData, S57_ATT_VALNMR, &valnmr)) {
             //PRINTF("FIXME: compute leglen to scale (NM)\n");
             double x1, y1, x2, y2;
             pt3 pt, ptlen;
-            double valnmr = S52_atof(valnmrstr->str);
 
             S57_getExt(geoData, &x1, &y1, &x2, &y2);
 
@@ -2836,7 +3536,7 @@ static int       _renderLS_LIGHTS05(S52_obj *obj)
 
         _glLoadIdentity(GL_MODELVIEW);
 
-        _glTranslated(ppt[0], ppt[1], 0.0);
+        _glTranslatedPRJ(ppt[0], ppt[1], 0.0);
         _glRotated(90.0-orient, 0.0, 0.0, 1.0);
 
         _pushScaletoPixel(FALSE);
@@ -2852,12 +3552,10 @@ static int       _renderLS_LIGHTS05(S52_obj *obj)
 
     }
 
-    if (NULL != sectr1str) {
-        double sectr1 = S52_atof(sectr1str->str);
-
+    if (TRUE == hasSectr1) {
         _glLoadIdentity(GL_MODELVIEW);
 
-        _glTranslated(ppt[0], ppt[1], 0.0);
+        _glTranslatedPRJ(ppt[0], ppt[1], 0.0);
         _glRotated(90.0-sectr1, 0.0, 0.0, 1.0);
 
         _pushScaletoPixel(FALSE);
@@ -2874,13 +3572,11 @@ static int       _renderLS_LIGHTS05(S52_obj *obj)
 
     }
 
-    if (NULL != sectr2str) {
-        double sectr2 = S52_atof(sectr2str->str);
-
+    if (TRUE == hasSectr2) {
         //_glMatrixMode  (GL_MODELVIEW);
         _glLoadIdentity(GL_MODELVIEW);
 
-        _glTranslated(ppt[0], ppt[1], 0.0);
+        _glTranslatedPRJ(ppt[0], ppt[1], 0.0);
         _glRotated(90.0-sectr2, 0.0, 0.0, 1.0);
 
         _pushScaletoPixel(FALSE);
@@ -2930,7 +3626,7 @@ static int       _renderLS_ownshp(S52_obj *obj)
         //_glMatrixMode  (GL_MODELVIEW);
         _glLoadIdentity(GL_MODELVIEW);
 
-        _glTranslated(ppt[0], ppt[1], 0.0);
+        _glTranslatedPRJ(ppt[0], ppt[1], 0.0);
         _glScaled(1.0, -1.0, 1.0);
         _glRotated(orient-90.0, 0.0, 0.0, 1.0);
 
@@ -2955,7 +3651,7 @@ static int       _renderLS_ownshp(S52_obj *obj)
         //_glMatrixMode  (GL_MODELVIEW);
         _glLoadIdentity(GL_MODELVIEW);
 
-        _glTranslated(ppt[0], ppt[1], 0.0);
+        _glTranslatedPRJ(ppt[0], ppt[1], 0.0);
         _glScaled(1.0, -1.0, 1.0);
         _glRotated(orient, 0.0, 0.0, 1.0);
 
@@ -2988,7 +3684,7 @@ static int       _renderLS_ownshp(S52_obj *obj)
             //_glMatrixMode  (GL_MODELVIEW);
             _glLoadIdentity(GL_MODELVIEW);
 
-            _glTranslated(ppt[0], ppt[1], 0.0);
+            _glTranslatedPRJ(ppt[0], ppt[1], 0.0);
 
 #ifdef S52_USE_GL2
             glUniformMatrix4fv(_uModelview,  1, GL_FALSE, _mvm[_mvmTop]);
@@ -3039,7 +3735,7 @@ static int       _renderLS_vessel(S52_obj *obj)
                 //_glMatrixMode  (GL_MODELVIEW);
                 _glLoadIdentity(GL_MODELVIEW);
 
-                _glTranslated(ppt[0], ppt[1], ppt[2]);
+                _glTranslatedPRJ(ppt[0], ppt[1], ppt[2]);
                 _glRotated(90.0 - headng, 0.0, 0.0, 1.0);
                 _glScaled(1.0, -1.0, 1.0);
 
@@ -3071,7 +3767,9 @@ static int       _renderLS_vessel(S52_obj *obj)
             guint     npt    = 0;
 
             if (TRUE == S57_getGeoData(geo, 0, &npt, &ppt)) {
-                pt3v pt[2] = {{ppt[0], ppt[1], 0.0}, {ppt[0]+veclenMX, ppt[1]+veclenMY, 0.0}};
+                double x = ppt[0] - _prjOrig.u;
+                double y = ppt[1] - _prjOrig.v;
+                pt3v pt[2] = {{x, y, 0.0}, {x+veclenMX, y+veclenMY, 0.0}};
 
 #ifdef S52_USE_GL2
                 GString *vestatstr = S57_getAttVal(geo, "vestat");
@@ -3088,7 +3786,7 @@ static int       _renderLS_vessel(S52_obj *obj)
                     };
 
                     _glLineWidth(3);
-                    glUniform1f(_uStipOn, 1.0);
+                    _glUseShader(SH_STIP);
                     glBindTexture(GL_TEXTURE_2D, _dashpa_mask_texID);
                     glEnableVertexAttribArray(_aUV);
                     glVertexAttribPointer    (_aUV, 2, GL_FLOAT, GL_FALSE, 0, ptr);
@@ -3100,7 +3798,7 @@ static int       _renderLS_vessel(S52_obj *obj)
                 glBindBuffer(GL_ARRAY_BUFFER, 0);
                 glBindTexture(GL_TEXTURE_2D,  0);
                 // turn OFF stippling
-                glUniform1f(_uStipOn, 0.0);
+                _glUseShader(SH_PLAIN);
 
                 glDisableVertexAttribArray(_aUV);
                 glDisableVertexAttribArray(_aPosition);
@@ -3179,7 +3877,7 @@ static int       _renderLS_afterglow(S52_obj *obj)
 
     //_checkError("_renderLS_afterglow() .. -0-");
     // turn ON after glow in shader
-    glUniform1f(_uGlowOn, 1.0);
+    _glUseShader(SH_GLOW);
 
     // vertex array - fill vbo arrays
     glEnableVertexAttribArray(_aPosition);
@@ -3221,12 +3919,17 @@ static int       _renderLS_afterglow(S52_obj *obj)
     // 3 - draw
     _glUniformMatrix4fv_uModelview();
     glDrawArrays(GL_POINTS, 0, pti);
+
+#ifdef S52_USE_GL2
+    if (TRUE == _dirtyOn)
+        _dirtyAddVert(pti, (GLfloat*)_tessWorkBuf_f->data, 0.0, 0.0);
+#endif
     //_checkError("_renderLS_afterglow() .. -2-");
 
 #ifdef S52_USE_GL2
     // 4 - done
     // turn OFF after glow
-    glUniform1f(_uGlowOn, 0.0);
+    _glUseShader(SH_PLAIN);
     glDisableVertexAttribArray(_aPosition);
     glDisableVertexAttribArray(_aAlpha);
 
@@ -3371,7 +4074,7 @@ static int       _renderLS(S52_obj *obj)
                     // alternate planned route
                     if (0 == g_strcmp0("leglin", S57_getName(geoData))) {
                         // FIXME: move to _renderLS_setPattDott()
-                        glUniform1f(_uStipOn, 1.0);
+                        _glUseShader(SH_STIP);
                         glBindTexture(GL_TEXTURE_2D, _dottpa_mask_texID);
 
                         float dx       = ppt[0] - ppt[3];
@@ -3395,7 +4098,7 @@ static int       _renderLS(S52_obj *obj)
 
                         // turn OFF stippling
                         glBindTexture(GL_TEXTURE_2D,  0);
-                        glUniform1f(_uStipOn, 0.0);
+                        _glUseShader(SH_PLAIN);
 
                     } else {
                         // all other line
@@ -3638,11 +4341,34 @@ static int       _renderLCring(S52_obj *obj, guint ringNo, double symlen_wrld)
         GLdouble offset_wrld_x = 0.0;
         GLdouble offset_wrld_y = 0.0;
 
+#ifdef S52_USE_GL3
+        // all symb's of this segment in one instanced draw
+        if (TRUE == _instBegin_gl3(nsym, symlen_wrld_x, symlen_wrld_y)) {
+            _glLoadIdentity(GL_MODELVIEW);
+
+            _glTranslatedPRJ(x1, y1, 0.0);
+            _glRotated(segang, 0.0, 0.0, 1.0);
+            _glScaled(1.0, -1.0, 1.0);
+
+            _pushScaletoPixel(TRUE);
+
+            _glCallList(DListData);
+
+            _popScaletoPixel();
+
+            _instEnd_gl3();
+
+            offset_wrld_x = symlen_wrld_x * nsym;
+            offset_wrld_y = symlen_wrld_y * nsym;
+            nsym          = 0;
+        }
+#endif
+
         // draw symb's as long as it fit the line length
         for (int j=0; j<nsym; ++j) {
             _glLoadIdentity(GL_MODELVIEW);
 
-            _glTranslated(x1+offset_wrld_x, y1+offset_wrld_y, 0.0);           // move coord sys. at symb pos.
+            _glTranslatedPRJ(x1+offset_wrld_x, y1+offset_wrld_y, 0.0);           // move coord sys. at symb pos.
             _glRotated(segang, 0.0, 0.0, 1.0);    // rotate coord sys. on Z
             _glScaled(1.0, -1.0, 1.0);
 
@@ -3665,7 +4391,7 @@ static int       _renderLCring(S52_obj *obj, guint ringNo, double symlen_wrld)
         //}
 
         {   // complete the rest of the line
-            pt3v pt[2] = {{x1+offset_wrld_x, y1+offset_wrld_y, z1}, {x2, y2, z2}};
+            pt3v pt[2] = {{x1+offset_wrld_x - _prjOrig.u, y1+offset_wrld_y - _prjOrig.v, z1}, {x2 - _prjOrig.u, y2 - _prjOrig.v, z2}};
             g_array_append_val(_tmpWorkBuffer, pt[0]);  // x1 y1 z1
             g_array_append_val(_tmpWorkBuffer, pt[1]);  // x2 y2 z2
         }
@@ -3733,8 +4459,11 @@ static int       _renderLC(S52_obj *obj)
 
 #ifdef S52_USE_GL2
             glUniformMatrix4fv(_uModelview,  1, GL_FALSE, _mvm[_mvmTop]);
-#endif
+            _d2f(_tessWorkBuf_f, 5, _hazardZone);
+            _DrawArrays_LINE_STRIP(5, (vertex_t *)_tessWorkBuf_f->data);
+#else
             _DrawArrays_LINE_STRIP(5, _hazardZone);
+#endif
         }
         //*/
     }
@@ -3824,18 +4553,143 @@ static int       _renderAC_NODATA_layer0(void)
     return TRUE;
 }
 
+#ifdef S52_USE_GL2
+// sector arc of all lights - built in world coords (relative to _prjOrig)
+// then drawn in one batch per color (black outline first)
+typedef struct _arcBatch {
+    S52_Color *col;
+    GArray    *vert;                // vertex_t x,y,z - GL_TRIANGLES
+} _arcBatch;
+static GArray *_arcBatchList = NULL;   // _arcBatch
+static int     _arcBatchOn   = FALSE;  // between S52_GL_lightsBeg() / S52_GL_lightsEnd()
+static guint   _nArcBatch    = 0;      // stat - arc in the batch
+
+static int       _arcAdd(S52_Color *col, double cx, double cy, double rin, double rout, double start, double sweep)
+// add arc (pixels radius) centered on cx,cy (PRJ) - same tessellation as _gluPartialDisk()
+{
+    _arcBatch *b = NULL;
+    for (guint i=0; i<_arcBatchList->len; ++i) {
+        _arcBatch *bi = &g_array_index(_arcBatchList, _arcBatch, i);
+        if (col == bi->col) {
+            b = bi;
+            break;
+        }
+    }
+    if (NULL == b) {
+        _arcBatch nb = {col, g_array_new(FALSE, FALSE, sizeof(vertex_t)*3)};
+        g_array_append_val(_arcBatchList, nb);
+        b = &g_array_index(_arcBatchList, _arcBatch, _arcBatchList->len-1);
+    }
+
+    int slices = (int) (sweep / 2.0);
+    if (slices < 2)           slices = 2;
+    if (slices >= CACHE_SIZE) slices = CACHE_SIZE - 1;
+
+    double x = cx - _prjOrig.u;
+    double y = cy - _prjOrig.v;
+    double a = start * M_PI / 180.0;
+    double s0 = sin(a);
+    double c0 = cos(a);
+    for (int i=1; i<=slices; ++i) {
+        a = (start + (sweep * i / slices)) * M_PI / 180.0;
+        double s1 = sin(a);
+        double c1 = cos(a);
+
+        vertex_t q[4*3] = {
+            x + rin  * s0 * _scalex, y + rin  * c0 * _scaley, 0.0,
+            x + rout * s0 * _scalex, y + rout * c0 * _scaley, 0.0,
+            x + rin  * s1 * _scalex, y + rin  * c1 * _scaley, 0.0,
+            x + rout * s1 * _scalex, y + rout * c1 * _scaley, 0.0
+        };
+        g_array_append_vals(b->vert, q+0, 3);
+        g_array_append_vals(b->vert, q+3, 3);
+
+        s0 = s1;
+        c0 = c1;
+    }
+
+    return TRUE;
+}
+#endif  // S52_USE_GL2
+
+int        S52_GL_lightsBeg(void)
+{
+#ifdef S52_USE_GL3
+    _flushSND_gl3();
+#endif
+
+#ifdef S52_USE_GL2
+    // PICK need one obj per draw
+    if (S52_GL_DRAW != _crnt_GL_cycle)
+        return FALSE;
+
+    if (NULL == _arcBatchList)
+        _arcBatchList = g_array_new(FALSE, FALSE, sizeof(_arcBatch));
+
+    for (guint i=0; i<_arcBatchList->len; ++i)
+        g_array_set_size(g_array_index(_arcBatchList, _arcBatch, i).vert, 0);
+
+    _arcBatchOn = TRUE;
+    _nArcBatch  = 0;
+
+    return TRUE;
+#else
+    return FALSE;
+#endif
+}
+
+int        S52_GL_lightsEnd(void)
+{
+#ifdef S52_USE_GL2
+    if (FALSE == _arcBatchOn)
+        return FALSE;
+
+    _arcBatchOn = FALSE;
+
+    _glLoadIdentity(GL_MODELVIEW);
+    _glUniformMatrix4fv_uModelview();
+
+    // arc winding depend on sweep
+    glDisable(GL_CULL_FACE);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glEnableVertexAttribArray(_aPosition);
+
+    for (guint i=0; i<_arcBatchList->len; ++i) {
+        _arcBatch *b = &g_array_index(_arcBatchList, _arcBatch, i);
+        if (0 == b->vert->len)
+            continue;
+
+        _setFragment(b->col);
+
+        glVertexAttribPointer(_aPosition, 3, GL_FLOAT, GL_FALSE, 0, b->vert->data);
+        glDrawArrays(GL_TRIANGLES, 0, b->vert->len);
+    }
+
+    glDisableVertexAttribArray(_aPosition);
+    glEnable(GL_CULL_FACE);
+
+    // debug
+    //PRINTF("DEBUG: light sector arc in batch = %u, color = %u\n", _nArcBatch, _arcBatchList->len);
+
+    _checkError("S52_GL_lightsEnd()");
+
+    return TRUE;
+#else
+    return FALSE;
+#endif
+}
+
 static int       _renderAC_LIGHTS05(S52_obj *obj)
 // this code is specific to CS LIGHTS05
 {
     S57_geo   *geoData   = S52_PL_getGeo(obj);
-    GString   *sectr1str = S57_getAttVal(geoData, "SECTR1");
-    GString   *sectr2str = S57_getAttVal(geoData, "SECTR2");
+    double     sectr1    = 0.0;
+    double     sectr2    = 0.0;
 
-    if ((NULL!=sectr1str) && (NULL!=sectr2str)) {
+    if (TRUE == S57_getAttValD(geoData, S57_ATT_SECTR1, &sectr1) &&
+        TRUE == S57_getAttValD(geoData, S57_ATT_SECTR2, &sectr2)) {
         S52_Color *c         = S52_PL_getACdata(obj);
         S52_Color *black     = S52_PL_getColor("CHBLK");
-        GLdouble   sectr1    = S52_atof(sectr1str->str);
-        GLdouble   sectr2    = S52_atof(sectr2str->str);
         double     sweep     = (sectr1 > sectr2) ? sectr2-sectr1+360 : sectr2-sectr1;
         GString   *extradstr = S57_getAttVal(geoData, "extend_arc_radius");
         GLdouble   radius    = 0.0;
@@ -3852,6 +4706,17 @@ static int       _renderAC_LIGHTS05(S52_obj *obj)
             radius = 20.0 / S52_MP_get(S52_MAR_DOTPITCH_MM_X);    // (not 20 mm on xoom)
         }
 
+#ifdef S52_USE_GL2
+        // DRAW - arc go in the batch (see S52_GL_lightsEnd())
+        if (TRUE == _arcBatchOn) {
+            _arcAdd(black, ppt[0], ppt[1], radius,   radius+4, sectr1+180, sweep);
+            _arcAdd(c,     ppt[0], ppt[1], radius+1, radius+3, sectr1+180, sweep);
+            ++_nArcBatch;
+
+            return TRUE;
+        }
+#endif
+
         // NOTE: specs say unit, assume it mean pixel
 #ifdef S52_USE_OPENGL_VBO
         _gluQuadricDrawStyle(_qobj, GLU_FILL);
@@ -3911,7 +4776,7 @@ static int       _renderAC_LIGHTS05(S52_obj *obj)
         //_glMatrixMode  (GL_MODELVIEW);
         _glLoadIdentity(GL_MODELVIEW);
 
-        _glTranslated(ppt[0], ppt[1], 0.0);
+        _glTranslatedPRJ(ppt[0], ppt[1], 0.0);
         _pushScaletoPixel(FALSE);
 
         // use VBO
@@ -3981,7 +4846,7 @@ static int       _renderAC_VRMEBL01(S52_obj *obj)
 
     _glLoadIdentity(GL_MODELVIEW);
 
-    _glTranslated(ppt[0], ppt[1], 0.0);
+    _glTranslatedPRJ(ppt[0], ppt[1], 0.0);
 
 #ifdef S52_USE_GL2
     glUniformMatrix4fv(_uModelview,  1, GL_FALSE, _mvm[_mvmTop]);
@@ -4048,17 +4913,17 @@ static int       _renderAP_NODATA_layer0(void)
     pt2v pt0, pt1, pt2, pt3;
 
     // double --> float if GLES2
-    pt0.x = _pmin.u;
-    pt0.y = _pmin.v;
+    pt0.x = _pmin.u - _prjOrig.u;
+    pt0.y = _pmin.v - _prjOrig.v;
 
-    pt1.x = _pmin.u;
-    pt1.y = _pmax.v;
+    pt1.x = _pmin.u - _prjOrig.u;
+    pt1.y = _pmax.v - _prjOrig.v;
 
-    pt2.x = _pmax.u;
-    pt2.y = _pmax.v;
+    pt2.x = _pmax.u - _prjOrig.u;
+    pt2.y = _pmax.v - _prjOrig.v;
 
-    pt3.x = _pmax.u;
-    pt3.y = _pmin.v;
+    pt3.x = _pmax.u - _prjOrig.u;
+    pt3.y = _pmin.v - _prjOrig.v;
 
     S52_Color *chgrd = S52_PL_getColor("CHGRD");  // grey, conspic
     _setFragment(chgrd);
@@ -4085,7 +4950,7 @@ static int       _renderAP_NODATA_layer0(void)
     glVertexAttribPointer    (_aPosition, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(GLfloat), ppt);
 
     // turn ON 'sampler2d'
-    glUniform1f(_uPattOn,       1.0);
+    _glUseShader(SH_PATT);
     glUniform1f(_uPattGridX,  pt0.x);
     glUniform1f(_uPattGridY,  pt0.y);
     glUniform1f(_uPattW,     tile_x);
@@ -4103,11 +4968,7 @@ static int       _renderAP_NODATA_layer0(void)
 
     glBindTexture(GL_TEXTURE_2D,  0);
 
-    glUniform1f(_uPattOn,    0.0);
-    glUniform1f(_uPattGridX, 0.0);
-    glUniform1f(_uPattGridY, 0.0);
-    glUniform1f(_uPattW,     0.0);
-    glUniform1f(_uPattH,     0.0);
+    _glUseShader(SH_PLAIN);
 
     glDisableVertexAttribArray(_aUV);
     glDisableVertexAttribArray(_aPosition);
@@ -4222,6 +5083,7 @@ static int       _renderTXTAA(S52_obj *obj, S52_Color *color, double x, double y
 {
     // TODO: use 'bsize'
     (void) bsize;
+    (void) obj;
 
     //g_assert(NULL != color);
 
@@ -4253,76 +5115,37 @@ static int       _renderTXTAA(S52_obj *obj, S52_Color *color, double x, double y
 
 #ifdef S52_USE_FREETYPE_GL
 #ifdef S52_USE_GL2
-    // static text
-    guint len = 0;
-    if ((S52_GL_DRAW==_crnt_GL_cycle) && (NULL!=obj)) {
-        GLuint vboID = S52_PL_getFreetypeGL_VBO(obj, &len);
-        if (GL_TRUE == glIsBuffer(vboID)) {
-            // connect to data in VBO GPU
-            glBindBuffer(GL_ARRAY_BUFFER, vboID);
-        } else {
-            _freetype_gl_buffer = _fill_freetype_gl_buffer(_freetype_gl_buffer, str, weight);
-            if (0 == _freetype_gl_buffer->len)
-                return TRUE;
-            else
-                len = _freetype_gl_buffer->len;
-
-            glGenBuffers(1, &vboID);
-
-            // glIsBuffer() fail!
-            if (0 == vboID) {
-                PRINTF("ERROR: glGenBuffers() fail\n");
-                g_assert(0);
-                return FALSE;
-            }
-
-            S52_PL_setFreetypeGL_VBO(obj, vboID, _freetype_gl_buffer->len);
+    // Note: all text go in the frame text batch, drawn in one call at S52_GL_end()
+    // or by S52_GL_drawStr() for lone text
+    GArray *run = _getGlyphRun_freetype_gl(str, weight);
+    if (0 == run->len)
+        return TRUE;
 
-            // bind VBOs for vertex array
-            glBindBuffer(GL_ARRAY_BUFFER, vboID);      // for vertex coordinates
-            // upload freetype_gl data to GPU
-            glBufferData(GL_ARRAY_BUFFER,
-                         _freetype_gl_buffer->len * sizeof(_freetype_gl_vertex_t),
-                         (const void *)_freetype_gl_buffer->data,
-                         GL_STATIC_DRAW);
+    if (0.0 != S52_MP_get(S52_MAR_DISP_DECLUTTER)) {
+        // pen bbox of the run (pixel)
+        double x1 =  INFINITY, y1 =  INFINITY;
+        double x2 = -INFINITY, y2 = -INFINITY;
+        _freetype_gl_vertex_t *v = (_freetype_gl_vertex_t *)run->data;
+        for (guint i=0; i<run->len; ++i, ++v) {
+            x1 = MIN(x1, v->x);
+            y1 = MIN(y1, v->y);
+            x2 = MAX(x2, v->x);
+            y2 = MAX(y2, v->y);
         }
-    }
-
-    // dynamique text
-    if (S52_GL_LAST == _crnt_GL_cycle) {
-        _freetype_gl_buffer = _fill_freetype_gl_buffer(_freetype_gl_buffer, str, weight);
-    }
 
-    // lone text - S52_drawStr()
-    if (S52_GL_NONE == _crnt_GL_cycle) {
-        _freetype_gl_buffer = _fill_freetype_gl_buffer(_freetype_gl_buffer, str, weight);
+        if (FALSE == _dclt_place(obj, FALSE, x, y, x1, y1, x2, y2))
+            return TRUE;
     }
 
 #ifdef S52_USE_TXT_SHADOW
     {
         S52_Color *c = S52_PL_getColor("UIBCK");   // opposite of CHBLK
-        _setFragment(c);
-
         // lower right - OK
-        if ((S52_GL_LAST==_crnt_GL_cycle) || (S52_GL_NONE==_crnt_GL_cycle)) {
-            // some MIO change age of target - need to resend the string
-            _renderTXTAA_gl2(x+_scalex, y-_scaley, (GLfloat*)_freetype_gl_buffer->data, _freetype_gl_buffer->len);
-        } else {
-            _renderTXTAA_gl2(x+_scalex, y-_scaley, NULL, len);
-        }
+        _renderTXTAA_gl2(x, y, 1.0, -1.0, c, run);
     }
 #endif  // S52_USE_TXT_SHADOW
 
-    _setFragment(color);
-
-    if ((S52_GL_LAST==_crnt_GL_cycle) || (S52_GL_NONE==_crnt_GL_cycle)) {
-        // some MIO change age of target - need to resend the string
-        _renderTXTAA_gl2(x, y, (GLfloat*)_freetype_gl_buffer->data, _freetype_gl_buffer->len);
-    } else {
-        _renderTXTAA_gl2(x, y, NULL, len);
-    }
-
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    _renderTXTAA_gl2(x, y, 0.0, 0.0, color, run);
 
 #endif  // S52_USE_GL2
 #endif  // S52_USE_FREETYPE_GL
@@ -5118,10 +5941,9 @@ static GLint     _createSymb(void)
 
 int        S52_GL_isSupp(S52_obj *obj)
 // TRUE if display of object is suppressed
-// also collect stat
+// Note: called from the cull worker - no write here (stat are counted by the caller)
 {
     if (S52_SUPP_ON == S52_PL_getObjToggleState(obj)) {
-        ++_oclip;
         return TRUE;
     }
 
@@ -5136,7 +5958,6 @@ int        S52_GL_isSupp(S52_obj *obj)
         double scamin = S57_getScamin(geo);
 
         if (scamin < _SCAMIN) {
-            ++_oclip;
             return TRUE;
         }
     }
@@ -5167,7 +5988,6 @@ int        S52_GL_isOFFview(S52_obj *obj)
 
     // S-N limits
     if ((y2 < _gmin.v) || (y1 > _gmax.v)) {
-        ++_oclip;
         return TRUE;
     }
 
@@ -5175,12 +5995,10 @@ int        S52_GL_isOFFview(S52_obj *obj)
     if (_gmax.u < _gmin.u) {
         // anti-meridian E-W limits
         if ((x2 < _gmin.u) && (x1 > _gmax.u)) {
-            ++_oclip;
             return TRUE;
         }
     } else {
         if ((x2 < _gmin.u) || (x1 > _gmax.u)) {
-            ++_oclip;
             return TRUE;
         }
     }
@@ -5188,6 +6006,34 @@ int        S52_GL_isOFFview(S52_obj *obj)
     return FALSE;
 }
 
+static int       _tileIsOFF(S52_obj *obj)
+// tile render: TRUE if obj is outside the tile padded by a tile on each side
+// the scene is culled once over all the tiles, this skip the obj of the other tiles
+// Note: symbol / text that reach more than a tile past their extent are cut at the tile edge
+{
+#ifdef S52_USE_GL2
+    // sector of lights reach past the light extent - _drawLights() cull them on the tile view
+    if ((NULL==_tileCrnt) || (TRUE==_arcBatchOn))
+        return FALSE;
+
+    // anti-meridian
+    if (_tilePad_gmax.u < _tilePad_gmin.u)
+        return FALSE;
+
+    double x1,y1,x2,y2;
+    S57_geo *geo = S52_PL_getGeo(obj);
+    if (FALSE == S57_getExt(geo, &x1, &y1, &x2, &y2))
+        return FALSE;
+
+    if ((y2<_tilePad_gmin.v) || (y1>_tilePad_gmax.v) || (x2<_tilePad_gmin.u) || (x1>_tilePad_gmax.u))
+        return TRUE;
+#else
+    (void)obj;
+#endif
+
+    return FALSE;
+}
+
 #ifdef S52_USE_GL2
 static int       _newTexture(S52_GL_ras *raster)
 // copy and blend raster 'data' to alpha texture
@@ -5274,6 +6120,11 @@ static int       _newTexture(S52_GL_ras *raster)
 
 int        S52_GL_drawRaster(S52_GL_ras *raster)
 {
+#ifdef S52_USE_GL3
+    // sounding under the raster
+    _flushSND_gl3();
+#endif
+
     // bailout if not in view
     // FIXME: test anti-meridien
     //if ((raster->pext.E < _pmin.u) || (raster->pext.N < _pmin.v) || (raster->pext.W > _pmax.u) || (raster->pext.S > _pmax.v)) {
@@ -5351,10 +6202,10 @@ int        S52_GL_drawRaster(S52_GL_ras *raster)
     if (TRUE == raster->isRADAR) {
         // "RADHI", "RADLO"
         S52_Color *radhi = S52_PL_getColor("RADHI");
-        glUniform4f(_uColor, radhi->R/255.0, radhi->G/255.0, radhi->B/255.0, (4 - (radhi->trans - '0'))*TRNSP_FAC_GLES2);
+        _glUniformColor(radhi->R/255.0, radhi->G/255.0, radhi->B/255.0, (4 - (radhi->trans - '0'))*TRNSP_FAC_GLES2);
     } else {
         S52_Color *dnghl = S52_PL_getColor("DNGHL");
-        glUniform4f(_uColor, dnghl->R/255.0, dnghl->G/255.0, dnghl->B/255.0, (4 - (dnghl->trans - '0'))*TRNSP_FAC_GLES2);
+        _glUniformColor(dnghl->R/255.0, dnghl->G/255.0, dnghl->B/255.0, (4 - (dnghl->trans - '0'))*TRNSP_FAC_GLES2);
     }
 
     // to fit an image in a POT texture
@@ -5363,10 +6214,10 @@ int        S52_GL_drawRaster(S52_GL_ras *raster)
     float fracX = 1.0;
     float fracY = 1.0;
     vertex_t ppt[4*3 + 4*2] = {
-        raster->pext.W, raster->pext.S, 0.0,        0.0f,  0.0f,
-        raster->pext.E, raster->pext.S, 0.0,        fracX, 0.0f,
-        raster->pext.E, raster->pext.N, 0.0,        fracX, fracY,
-        raster->pext.W, raster->pext.N, 0.0,        0.0f,  fracY
+        raster->pext.W - _prjOrig.u, raster->pext.S - _prjOrig.v, 0.0,        0.0f,  0.0f,
+        raster->pext.E - _prjOrig.u, raster->pext.S - _prjOrig.v, 0.0,        fracX, 0.0f,
+        raster->pext.E - _prjOrig.u, raster->pext.N - _prjOrig.v, 0.0,        fracX, fracY,
+        raster->pext.W - _prjOrig.u, raster->pext.N - _prjOrig.v, 0.0,        0.0f,  fracY
     };
 
     // FIXME: need this for bathy
@@ -5378,7 +6229,7 @@ int        S52_GL_drawRaster(S52_GL_ras *raster)
     glEnableVertexAttribArray(_aPosition);
     glVertexAttribPointer    (_aPosition, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(GLfloat), ppt);
 
-    glUniform1f(_uStipOn, 1.0);
+    _glUseShader(SH_STIP);
     glBindTexture(GL_TEXTURE_2D, raster->texID);
 
     _glUniformMatrix4fv_uModelview();
@@ -5388,7 +6239,7 @@ int        S52_GL_drawRaster(S52_GL_ras *raster)
 
     glBindTexture(GL_TEXTURE_2D,  0);
 
-    glUniform1f(_uStipOn, 0.0);
+    _glUseShader(SH_PLAIN);
 
     glDisableVertexAttribArray(_aUV);
     glDisableVertexAttribArray(_aPosition);
@@ -5425,6 +6276,18 @@ int        S52_GL_drawText(S52_obj *obj, gpointer user_data)
     // quiet compiler
     (void)user_data;
 
+    // tile cache - text of an other tile
+    if (TRUE == _tileIsOFF(obj))
+        return TRUE;
+
+#ifdef S52_USE_GL3
+    _flushSND_gl3();
+#endif
+
+    // dirty rectangle - text extend the window extent of this obj
+    if (TRUE == _dirtyOn)
+        _dirtyBeg(obj);
+
     S52_CmdWrd cmdWrd = S52_PL_iniCmd(obj);
 
     while (S52_CMD_NONE != cmdWrd) {
@@ -5443,6 +6306,62 @@ int        S52_GL_drawText(S52_obj *obj, gpointer user_data)
     return TRUE;
 }
 
+int        S52_GL_drawTextEnd(void)
+// draw the text batch - at the end of each cell so that the better scale cell drawn next
+// cover the text of the cell under it
+{
+#if (defined(S52_USE_GL2) && defined(S52_USE_FREETYPE_GL))
+    _flushTXTAA_gl2();
+#endif
+
+    return TRUE;
+}
+
+static guint64    _getStateKey(S52_obj *obj, S52_CmdWrd cmdWrd)
+// GL state of the current command of 'obj'
+// bit 60-63: command word, 56-59: pen width, 52-55: line style, 0-51: color or VBO/texture (DList)
+{
+    guint64  pen_w = 0;
+    guint64  style = 0;
+    gpointer state = NULL;
+
+    switch (cmdWrd) {
+        case S52_CMD_SIM_LN: {
+            char       w = '1';
+            char       s = 'L';
+            S52_Color *c = NULL;
+            S52_PL_getLSdata(obj, &w, &s, &c);
+            pen_w = w - '0';
+            style = s;
+            state = c;
+            break;
+        }
+        case S52_CMD_ARE_CO: state = S52_PL_getACdata(obj);    break;
+        case S52_CMD_SYM_PT:
+        case S52_CMD_COM_LN:
+        case S52_CMD_ARE_PA: state = S52_PL_getDListData(obj); break;
+        default: break;
+    }
+
+    return ((guint64)cmdWrd << 60) | ((pen_w & 0xF) << 56) | ((style & 0xF) << 52) |
+           ((guint64)GPOINTER_TO_SIZE(state) & G_GUINT64_CONSTANT(0xFFFFFFFFFFFFF));
+}
+
+guint64    S52_GL_getStateKey(S52_obj *obj)
+{
+    S52_CmdWrd cmdWrd = S52_PL_iniCmd(obj);
+
+    // skip text - drawn after
+    while ((S52_CMD_TXT_TX==cmdWrd) || (S52_CMD_TXT_TE==cmdWrd))
+        cmdWrd = S52_PL_getCmdNext(obj);
+
+    guint64 key = _getStateKey(obj, cmdWrd);
+
+    S52_PL_iniCmd(obj);
+
+    return key;
+}
+
 int        S52_GL_draw(S52_obj *obj, gpointer user_data)
 // draw all
 // later redraw only dirty region
@@ -5498,6 +6417,20 @@ int        S52_GL_draw(S52_obj *obj, gpointer user_data)
     //}
     //------------------------------------------------------
 
+    // tile cache - obj of an other tile
+    if (TRUE == _tileIsOFF(obj))
+        return TRUE;
+
+    // dirty rectangle - window extent of this obj
+    if (TRUE == _dirtyOn)
+        _dirtyBeg(obj);
+
+#ifdef S52_USE_GL3
+    // sounding batch - keep the draw order with the other obj
+    if ((NULL!=_sndOrder_gl3) && (0<_sndOrder_gl3->len) && (0!=g_strcmp0(S52_PL_getOBCL(obj), "SOUNDG")))
+        _flushSND_gl3();
+#endif
+
 
     /* FIXME: check atomic for each obj
     // but _atomicAbort is local to S52.c!
@@ -5521,10 +6454,26 @@ int        S52_GL_draw(S52_obj *obj, gpointer user_data)
 
     ++_nobj;
 
+    // simplified LINES / AREAS for this scale
+    S57_geo *geo = S52_PL_getGeo(obj);
+    if (0 < _lodCrnt) {
+        if (0 < S57_setLOD(geo, _lodCrnt))
+            _nLODsaved += S57_getLODsaved(geo);
+    }
+
     S52_CmdWrd cmdWrd = S52_PL_iniCmd(obj);
 
     while (S52_CMD_NONE != cmdWrd) {
 
+        // stat - GL state change
+        if ((S52_GL_DRAW==_crnt_GL_cycle) && (S52_CMD_SYM_PT<=cmdWrd) && (cmdWrd<=S52_CMD_ARE_PA)) {
+            guint64 state = _getStateKey(obj, cmdWrd);
+            if (state != _stateLast) {
+                _stateLast = state;
+                ++_nState;
+            }
+        }
+
         switch (cmdWrd) {
             /// text is parsed/rendered separetly now
             case S52_CMD_TXT_TX:
@@ -5552,6 +6501,9 @@ int        S52_GL_draw(S52_obj *obj, gpointer user_data)
         cmdWrd = S52_PL_getCmdNext(obj);
     }
 
+    // back to full resolution (CS, cursor pick, ..)
+    S57_setLOD(geo, 0);
+
     // Can cursor pick now use the journal in S52.c instead of the GPU?
     // NO, if extent is use then concave AREA and LINES can trigger false positive
     if (S52_GL_PICK == _crnt_GL_cycle) {
@@ -5580,6 +6532,185 @@ int        S52_GL_draw(S52_obj *obj, gpointer user_data)
     return TRUE;
 }
 
+static int       _dirtyRestore(void)
+// drawLast() - restore the view from the FB texture, all of it or only the area
+// of the mariner obj that change since the previous drawLast()
+{
+#ifdef S52_USE_GL2
+    g_array_set_size(_dirtyRest, 0);
+    g_array_set_size(_dirtyCrnt, 0);
+    g_hash_table_remove_all(_dirtyIdx);
+
+    _dirtyOn   = (1.0 == S52_MP_get(S52_MAR_DISP_DIRTY_RECT));
+    _dirtyFull = (FALSE==_dirtyOn) || (TRUE==_dirtyAll);
+    _dirtyAll  = FALSE;
+
+    if (TRUE == _dirtyFull) {
+        S52_GL_drawFBPixels();
+        _nDirtyPx = _vp.w * _vp.h;
+
+        return TRUE;
+    }
+
+    // area of the obj that change (move, delete, new look) in the previous frame
+    for (guint i=0; i<_dirtyPrev->len; ++i) {
+        _dirtyBox *b = &g_array_index(_dirtyPrev, _dirtyBox, i);
+        g_hash_table_insert(_dirtyIdx, b->obj, GUINT_TO_POINTER(i+1));
+
+        b->redraw = (NULL != g_hash_table_lookup(_dirtyObj, b->obj));
+        if (TRUE == b->redraw)
+            _dirtyAddRest(b);
+    }
+
+    // obj that overlap a restored area are redrawn, so restore all of it
+    int more = TRUE;
+    while (TRUE == more) {
+        more = FALSE;
+        for (guint i=0; i<_dirtyPrev->len; ++i) {
+            _dirtyBox *b = &g_array_index(_dirtyPrev, _dirtyBox, i);
+            if (TRUE == b->redraw)
+                continue;
+
+            for (guint j=0; j<_dirtyRest->len; ++j) {
+                if (TRUE == _dirtyIntersec(b, &g_array_index(_dirtyRest, _dirtyBox, j))) {
+                    b->redraw = TRUE;
+                    _dirtyAddRest(b);
+                    more = TRUE;
+                    break;
+                }
+            }
+        }
+    }
+
+    _nDirtyPx = 0;
+    for (guint i=0; i<_dirtyRest->len; ++i) {
+        _dirtyBox *r = &g_array_index(_dirtyRest, _dirtyBox, i);
+
+        // clip to viewport
+        int x1 = MAX((int)floor(r->x1), (int) _vp.x);
+        int y1 = MAX((int)floor(r->y1), (int) _vp.y);
+        int x2 = MIN((int)ceil (r->x2), (int)(_vp.x + _vp.w));
+        int y2 = MIN((int)ceil (r->y2), (int)(_vp.y + _vp.h));
+        if ((x2<=x1) || (y2<=y1))
+            continue;
+
+        S52_GL_setScissor(x1, y1, x2-x1, y2-y1);
+        S52_GL_drawFBPixels();
+        _nDirtyPx += (x2-x1) * (y2-y1);
+    }
+    S52_GL_setScissor(0, 0, -1, -1);
+
+#else   // S52_USE_GL2
+    S52_GL_drawFBPixels();
+#endif  // S52_USE_GL2
+
+    return TRUE;
+}
+
+static int       _dirtyEnd(void)
+// this frame extent become the previous one
+{
+#ifdef S52_USE_GL2
+    if (TRUE == _dirtyOn) {
+        GArray *tmp = _dirtyPrev;
+        _dirtyPrev  = _dirtyCrnt;
+        _dirtyCrnt  = tmp;
+    } else {
+        g_array_set_size(_dirtyPrev, 0);
+        _dirtyAll = TRUE;
+    }
+    g_hash_table_remove_all(_dirtyObj);
+
+    _dirtyOn = FALSE;
+#endif
+
+    return TRUE;
+}
+
+#ifdef S52_USE_GL2
+static int       _tileAddDirty(S52_obj *obj)
+// keep the PRJ extent of obj - the tiles over it are rendered again at the next DRAW
+{
+    double x1, y1, x2, y2;
+    if (FALSE == S57_getExt(S52_PL_getGeo(obj), &x1, &y1, &x2, &y2)) {
+        _tileFlush = TRUE;
+        return FALSE;
+    }
+
+    double xyz[6] = {x1, y1, 0.0, x2, y2, 0.0};
+    if (FALSE == S57_geo2prj3dv(2, xyz)) {
+        _tileFlush = TRUE;
+        return FALSE;
+    }
+
+    if (NULL == _tileDirtyExt)
+        _tileDirtyExt = g_array_new(FALSE, FALSE, sizeof(double));
+
+    double ext[4] = {xyz[0], xyz[1], xyz[3], xyz[4]};
+    g_array_append_vals(_tileDirtyExt, ext, 4);
+
+    return TRUE;
+}
+#endif  // S52_USE_GL2
+
+int        S52_GL_setDirty(S52_obj *obj)
+{
+#ifdef S52_USE_GL2
+    // mariner obj of layer 0-8 are drawn in the tiles - old extent now, new extent at the next DRAW
+    if ((NULL!=obj) && (S52_PL_getDPRI(obj)<S52_PRIO_MARINR)) {
+        _tileAddDirty(obj);
+
+        if (NULL == _tileDirtyObj)
+            _tileDirtyObj = g_hash_table_new(g_direct_hash, g_direct_equal);
+        g_hash_table_insert(_tileDirtyObj, obj, obj);
+    }
+#endif
+
+    // GL not init yet - first drawLast() restore all anyway
+    if (NULL == _dirtyObj)
+        return FALSE;
+
+    if (NULL == obj)
+        _dirtyAll = TRUE;
+    else
+        g_hash_table_insert(_dirtyObj, obj, obj);
+
+    return TRUE;
+}
+
+int        S52_GL_isDirty(S52_obj *obj)
+{
+    if ((S52_GL_LAST!=_crnt_GL_cycle) || (FALSE==_dirtyOn) || (TRUE==_dirtyFull))
+        return TRUE;
+
+#ifdef S52_USE_GL2
+    guint idx = GPOINTER_TO_UINT(g_hash_table_lookup(_dirtyIdx, obj));
+
+    // new obj
+    if (0 == idx)
+        return TRUE;
+
+    _dirtyBox *b = &g_array_index(_dirtyPrev, _dirtyBox, idx-1);
+    if (TRUE == b->redraw)
+        return TRUE;
+
+    // an obj drawn before this one (new, moved) land on it - the area is not restored
+    // so redraw it on top to keep the draw order and restore all the view next time
+    for (guint i=0; i<_dirtyCrnt->len; ++i) {
+        _dirtyBox *d = &g_array_index(_dirtyCrnt, _dirtyBox, i);
+        if ((TRUE==d->redraw) && (TRUE==_dirtyIntersec(b, d))) {
+            _dirtyAll = TRUE;
+            return TRUE;
+        }
+    }
+
+    // still on screen, keep extent for the next frame
+    g_array_append_val(_dirtyCrnt, *b);
+#endif
+
+    return FALSE;
+}
+
 int        S52_GL_begin(S52_GL_cycle cycle)
 {
     CHECK_GL_END;
@@ -5778,6 +6909,26 @@ int        S52_GL_begin(S52_GL_cycle cycle)
     if (S52_GL_DRAW == _crnt_GL_cycle) {
         // this will setup _pmin/_pmax, need a valide _vp
         _doProjection(_vp, _centerLat, _centerLon, _rangeNM/60.0);
+
+        // keep the placement of the last frame if the view is the same
+        _dclt_begin();
+
+        _nState    = 0;
+        _stateLast = 0;
+#ifdef S52_USE_GL3
+        _nMDI_gl3     = 0;
+        _nInst_gl3    = 0;
+        _nSnd_gl3     = 0;
+        _nSndCall_gl3 = 0;
+#endif
+
+        // level of detail of LINES / AREAS: coarsest level with a sub-pixel tolerance
+        _lodCrnt   = 0;
+        _nLODsaved = 0;
+        for (guint l=1; l<S57_LOD_NBR; ++l) {
+            if (S57_getLODtol(l) <= _scalex)
+                _lodCrnt = l;
+        }
     }
 
     // then create all PLib symbol
@@ -5852,7 +7003,8 @@ int        S52_GL_begin(S52_GL_cycle cycle)
             }
 
             // load FB that was filled with the previous draw() call
-            S52_GL_drawFBPixels();
+            // (all of it or only the area of the mariner obj that change)
+            _dirtyRestore();
         }
 
 #endif  // S52_USE_RADAR
@@ -5892,13 +7044,48 @@ int        S52_GL_end(S52_GL_cycle cycle)
     cogl_end_gl();
 #endif
 
+#ifdef S52_USE_GL3
+    // last sounding of this frame
+    _flushSND_gl3();
+#endif
+
+#if (defined(S52_USE_GL2) && defined(S52_USE_FREETYPE_GL))
+    // text on top of everything
+    _flushTXTAA_gl2();
+#endif
+
     _glMatrixDel(VP_PRJ);
 
     // texture of FB need update
     if (S52_GL_DRAW == _crnt_GL_cycle) {
         _fb_update = TRUE;
+        _dirtyAll  = TRUE;
+    }
+
+    if (S52_GL_LAST == _crnt_GL_cycle) {
+        // debug - dirty rectangle (S52_MAR_DISP_DIRTY_RECT)
+#if (defined(S52_USE_GL2) && defined(S52_DEBUG))
+        _dirtyStatPx   += _nDirtyPx;
+        _dirtyStatFull += (TRUE==_dirtyFull) ? 1 : 0;
+        if (DIRTY_STAT_N == ++_dirtyStatN) {
+            double vpPx = (double)_vp.w * _vp.h;
+            PRINTF("DEBUG: drawLast restored %.0f px/frame (%.1f%% of view), %u/%u frame full, %u rect last frame\n",
+                   _dirtyStatPx/_dirtyStatN, (0.0==vpPx) ? 0.0 : (100.0*_dirtyStatPx)/(vpPx*_dirtyStatN),
+                   _dirtyStatFull, _dirtyStatN, _dirtyRest->len);
+            _dirtyStatN    = 0;
+            _dirtyStatFull = 0;
+            _dirtyStatPx   = 0.0;
+        }
+#endif
+        _dirtyEnd();
     }
 
+    // dump of the previous frame - PBO that landed go to the encoder, free the one encoded
+#ifdef S52_USE_GL3
+    _pboResolve_gl3(FALSE);
+#endif
+    _dumpReap(FALSE);
+
     /* debug - flush / finish and blit + swap
     if (S52_GL_DRAW == _crnt_GL_cycle) {
     //if (S52_GL_LAST == _crnt_GL_cycle) {
@@ -5929,6 +7116,25 @@ int        S52_GL_end(S52_GL_cycle cycle)
     }
     //*/
 
+    //if (S52_GL_DRAW == _crnt_GL_cycle)
+    //    PRINTF("DEBUG: declutter dropped = %i\n", _nDclt);
+    //if (S52_GL_DRAW == _crnt_GL_cycle)
+    //    PRINTF("DEBUG: GL state change = %i, cmd = %i\n", _nState, _ncmd);
+    //if (S52_GL_DRAW == _crnt_GL_cycle)
+    //    PRINTF("DEBUG: LOD %i, coords saved = %i\n", _lodCrnt, _nLODsaved);
+
+#ifdef S52_USE_GL2
+    //if (S52_GL_DRAW == _crnt_GL_cycle)
+    //    PRINTF("DEBUG: tile hit = %i, miss = %i\n", _nTileHit, _nTileMiss);
+    //    PRINTF("DEBUG: AP atlas hit = %i, miss = %i\n", _nAPAtlasHit, _nAPAtlasMiss);
+#endif
+#ifdef S52_USE_GL3
+    //if (S52_GL_DRAW == _crnt_GL_cycle)
+    //    PRINTF("DEBUG: GL3 MDI call = %i, instanced symb = %i\n", _nMDI_gl3, _nInst_gl3);
+    //if (S52_GL_DRAW == _crnt_GL_cycle)
+    //    PRINTF("DEBUG: GL3 sounding digit = %i, instanced call = %i\n", _nSnd_gl3, _nSndCall_gl3);
+#endif
+
 #ifdef S52_USE_GL2
     //PRINTF("SKIP POIN_T glDrawArrays(): nFragment = %i\n", _nFrag);
     //PRINTF("SKIP identity = %i\n", _identity_MODELVIEW_cnt);
@@ -5944,18 +7150,8 @@ int        S52_GL_end(S52_GL_cycle cycle)
     return TRUE;
 }
 
-int        S52_GL_delDL(S52_obj *obj)
-// delete the GL part of S57 geo object (Display List)
-// S52_obj is use only by FREETYPE_GL
+static int       _delPrim(S57_prim *prim)
 {
-    S57_geo  *geoData = S52_PL_getGeo(obj);
-    S57_prim *prim    = S57_getPrimGeo(geoData);
-
-#ifdef S52_USE_GLSC1
-    // SC can't delete a display list --no garbage collector
-    return TRUE;
-#endif
-
     // S57 have Display List / VBO
     if (NULL != prim) {
         guint     primNbr = 0;
@@ -5969,6 +7165,9 @@ int        S52_GL_delDL(S52_obj *obj)
 #ifdef S52_USE_OPENGL_VBO
         // delete VBO when program terminated
         if (GL_TRUE == glIsBuffer(vboID)) {
+#ifdef S52_USE_GL3
+            _delVAO_gl3(vboID);
+#endif
             glDeleteBuffers(1, &vboID);
             vboID = 0;
             S57_setPrimDList(prim, vboID);
@@ -5978,27 +7177,6 @@ int        S52_GL_delDL(S52_obj *obj)
             return FALSE;
         }
 
-#ifdef S52_USE_FREETYPE_GL
-        {   // delete text if any
-            guint len;
-            guint vboID = S52_PL_getFreetypeGL_VBO(obj, &len);
-            if (GL_TRUE == glIsBuffer(vboID)) {
-                glDeleteBuffers(1, &vboID);
-
-                len   = 0;
-                vboID = 0;
-                S52_PL_setFreetypeGL_VBO(obj, vboID, len);
-            }
-            /* debug
-            else
-            {
-                PRINTF("WARNING: ivalid FreetypeGL VBOID(%i)\n", vboID);
-                //g_assert(0);
-            }
-            */
-        }
-#endif
-
 #else  // S52_USE_OPENGL_VBO
         // 'vboID' is in fact a DList here
         if (GL_TRUE == glIsList(vboID)) {
@@ -6013,9 +7191,46 @@ int        S52_GL_delDL(S52_obj *obj)
 #endif  // S52_USE_OPENGL_VBO
     }
 
-    _checkError("S52_GL_delDL()");
+    return TRUE;
+}
+
+int        S52_GL_delDL(S52_obj *obj)
+// delete the GL part of S57 geo object (Display List)
+// S52_obj is use only by FREETYPE_GL
+{
+    S57_geo  *geoData = S52_PL_getGeo(obj);
+    int       ret     = TRUE;
 
+    // placement of this obj is cached (key: obj)
+    S52_GL_resetDeclutter();
+
+#ifdef S52_USE_GL2
+    // obj gone - its old extent is allready kept by S52_GL_setDirty()
+    if (NULL != _tileDirtyObj)
+        g_hash_table_remove(_tileDirtyObj, obj);
+
+    // release AP tile in atlas
+    _apAtlas_delObj(obj);
+#endif
+
+#ifdef S52_USE_GLSC1
+    // SC can't delete a display list --no garbage collector
     return TRUE;
+#endif
+
+    // each level of detail has its own tessalation
+    for (guint l=0; l<S57_LOD_NBR; ++l) {
+        if (l != S57_setLOD(geoData, l))
+            continue;
+
+        if (FALSE == _delPrim(S57_getPrimGeo(geoData)))
+            ret = FALSE;
+    }
+    S57_setLOD(geoData, 0);
+
+    _checkError("S52_GL_delDL()");
+
+    return ret;
 }
 
 int        S52_GL_delRaster(S52_GL_ras *raster, int texOnly)
@@ -6112,6 +7327,15 @@ static int       _contextValid(void)
             PRINTF("DEBUG: GL_OES_point_sprite FAILED\n");
             _GL_OES_point_sprite = FALSE;
         }
+
+        // MDI - GLES3.1 extension (desktop GL has the ARB/4.3 entry point, not this one)
+        if (NULL != g_strrstr((const char *)extensions, "GL_EXT_multi_draw_indirect")) {
+            PRINTF("DEBUG: GL_EXT_multi_draw_indirect OK\n");
+            _GL_EXT_multi_draw_indirect = TRUE;
+        } else {
+            PRINTF("DEBUG: GL_EXT_multi_draw_indirect FAILED\n");
+            _GL_EXT_multi_draw_indirect = FALSE;
+        }
     }
 
 #if !defined(S52_USE_GL2)
@@ -6170,6 +7394,17 @@ int        S52_GL_init(void)
     if (NULL == _objPick)
         _objPick = g_ptr_array_new();
 
+    if (NULL == _dirtyObj)
+        _dirtyObj = g_hash_table_new(g_direct_hash, g_direct_equal);
+#ifdef S52_USE_GL2
+    if (NULL == _dirtyPrev) {
+        _dirtyPrev = g_array_new(FALSE, FALSE, sizeof(_dirtyBox));
+        _dirtyCrnt = g_array_new(FALSE, FALSE, sizeof(_dirtyBox));
+        _dirtyRest = g_array_new(FALSE, FALSE, sizeof(_dirtyBox));
+        _dirtyIdx  = g_hash_table_new(g_direct_hash, g_direct_equal);
+    }
+#endif
+
     //_DEBUG = TRUE;
 
     // tmp buffer
@@ -6222,6 +7457,15 @@ int        S52_GL_done(void)
 
     _freeGLU();
 
+    // finish dump in flight
+    if (NULL != _dumpPool) {
+        S52_GL_dumpSync();
+        g_thread_pool_free(_dumpPool, FALSE, TRUE);
+        _dumpPool = NULL;
+        g_async_queue_unref(_dumpDone);
+        _dumpDone = NULL;
+    }
+
     if (NULL != _fb_pixels) {
         g_free(_fb_pixels);
         _fb_pixels = NULL;
@@ -6232,11 +7476,35 @@ int        S52_GL_done(void)
         _objPick = NULL;
     }
 
+    if (NULL != _dirtyObj) {
+        g_hash_table_destroy(_dirtyObj);
+        _dirtyObj = NULL;
+    }
+#ifdef S52_USE_GL2
+    if (NULL != _dirtyPrev) {
+        g_array_free(_dirtyPrev, TRUE); _dirtyPrev = NULL;
+        g_array_free(_dirtyCrnt, TRUE); _dirtyCrnt = NULL;
+        g_array_free(_dirtyRest, TRUE); _dirtyRest = NULL;
+        g_hash_table_destroy(_dirtyIdx); _dirtyIdx = NULL;
+    }
+#endif
+    _dirtyAll = TRUE;
+
     if (NULL != _tmpWorkBuffer) {
         g_array_free(_tmpWorkBuffer, TRUE);
         _tmpWorkBuffer = NULL;
     }
 
+    if (NULL != _dclt_cache) {
+        g_hash_table_destroy(_dclt_cache);
+        _dclt_cache = NULL;
+    }
+    g_free(_dclt_grid);
+    _dclt_grid  = NULL;
+    _dclt_gridW = 0;
+    _dclt_gridH = 0;
+    _dclt_valid = FALSE;
+
 #ifdef S52_USE_AFGLOW
     if (NULL != _aftglwColorArr) {
         g_array_free(_aftglwColorArr, TRUE);
@@ -6270,12 +7538,46 @@ int        S52_GL_done(void)
     glDeleteTextures(1, &_dashpa_mask_texID);
     _dashpa_mask_texID = 0;
 
-    glDeleteProgram(_programObject);
+    _apAtlas_done();
+
+#ifdef S52_USE_GL3
+    _done_gl3();
+#endif
+
+    for (int sh=0; sh<SH_NUM; ++sh) {
+        glDeleteProgram(_shProgs[sh].prog);
+        _shProgs[sh].prog = 0;
+    }
     _programObject = 0;
+    _shCrnt        = SH_PLAIN;
 
     glDeleteFramebuffers(1, &_fboID);
     _fboID = 0;
 
+    if (NULL != _arcBatchList) {
+        for (guint i=0; i<_arcBatchList->len; ++i)
+            g_array_free(g_array_index(_arcBatchList, _arcBatch, i).vert, TRUE);
+        g_array_free(_arcBatchList, TRUE);
+        _arcBatchList = NULL;
+    }
+
+    if (NULL != _tileCache) {
+        g_hash_table_destroy(_tileCache);
+        _tileCache = NULL;
+        g_ptr_array_free(_tileView, TRUE);
+        _tileView = NULL;
+        glDeleteFramebuffers(1, &_tileFBO);
+        _tileFBO = 0;
+    }
+    if (NULL != _tileDirtyObj) {
+        g_hash_table_destroy(_tileDirtyObj);
+        _tileDirtyObj = NULL;
+    }
+    if (NULL != _tileDirtyExt) {
+        g_array_free(_tileDirtyExt, TRUE);
+        _tileDirtyExt = NULL;
+    }
+
 
 #ifdef S52_USE_FREETYPE_GL
     texture_font_delete(_freetype_gl_font[0]);
@@ -6291,9 +7593,17 @@ int        S52_GL_done(void)
         glDeleteBuffers(1, &_freetype_gl_textureID);
         _freetype_gl_textureID = 0;
     }
-    if (NULL != _freetype_gl_buffer) {
-        g_array_free(_freetype_gl_buffer, TRUE);
-        _freetype_gl_buffer = NULL;
+    if (NULL != _freetype_gl_textBatch) {
+        g_array_free(_freetype_gl_textBatch, TRUE);
+        _freetype_gl_textBatch = NULL;
+    }
+    if (NULL != _freetype_gl_runCache) {
+        g_hash_table_destroy(_freetype_gl_runCache);
+        _freetype_gl_runCache = NULL;
+    }
+    if (NULL != _freetype_gl_runKey) {
+        g_string_free(_freetype_gl_runKey, TRUE);
+        _freetype_gl_runKey = NULL;
     }
 #endif
 #endif  // S52_USE_GL2
@@ -6433,7 +7743,7 @@ int        S52_GL_getViewPort(int *x, int *y, int *width, int *height)
     *x      = _vp.x;
     *y      = _vp.y;
     *width  = _vp.w;
-    *height = _vp.w;
+    *height = _vp.h;
 
     return TRUE;
 }
@@ -6443,6 +7753,11 @@ int        S52_GL_setScissor(int x, int y, int width, int height)
 // when w & h < 0, GL_INVALID_VALUE is generated
 // so if either width or height is negative the turn of glDisable(GL_SCISSOR_TEST)
 {
+#ifdef S52_USE_GL3
+    // sounding batched in the previous scissor box
+    _flushSND_gl3();
+#endif
+
     // NOTE: width & height are in fact GLsizei, a pseudo unsigned int
     // it is a 'int32' that can't be negative
     if (width<0 || height<0) {
@@ -6594,16 +7909,16 @@ cchar     *S52_GL_getNameObjPick(void)
 
                 if (NULL == geoRelIDs) {
                     geoRelIDs = g_string_new("");
-                    g_string_printf(geoRelIDs, ":%i,%i", S57_getGeoS57ID(geoRel), idAssoc);
+                    g_string_printf(geoRelIDs, ":%u,%u", S57_getGeoS57ID(geoRel), idAssoc);
                 } else {
-                    g_string_append_printf(geoRelIDs, ",%i", idAssoc);
+                    g_string_append_printf(geoRelIDs, ",%u", idAssoc);
                 }
 
                 splitRefs++;
             }
 
             // if in a relation then append it to pick string
-            g_string_printf(_strPick, "%s:%i%s", name, S57ID, geoRelIDs->str);
+            g_string_printf(_strPick, "%s:%u%s", name, S57ID, geoRelIDs->str);
 
             g_string_free(geoRelIDs, TRUE);
 
@@ -6612,7 +7927,7 @@ cchar     *S52_GL_getNameObjPick(void)
     }
 #endif  // S52_USE_C_AGGR_C_ASSO
 
-    g_string_printf(_strPick, "%s:%i", name, S57ID);
+    g_string_printf(_strPick, "%s:%u", name, S57ID);
 
     return (const char *)_strPick->str;
 }
@@ -6679,13 +7994,13 @@ int        S52_GL_drawFBPixels(void)
 
 #ifdef S52_USE_GL2
     // turn ON 'sampler2d'
-    glUniform1f(_uBlitOn, 1.0);
+    _glUseShader(SH_BLIT);
 
     GLfloat ppt[4*3 + 4*2] = {
-        _pmin.u, _pmin.v, 0.0,   0.0, 0.0,
-        _pmin.u, _pmax.v, 0.0,   0.0, 1.0,
-        _pmax.u, _pmax.v, 0.0,   1.0, 1.0,
-        _pmax.u, _pmin.v, 0.0,   1.0, 0.0
+        _pmin.u - _prjOrig.u, _pmin.v - _prjOrig.v, 0.0,   0.0, 0.0,
+        _pmin.u - _prjOrig.u, _pmax.v - _prjOrig.v, 0.0,   0.0, 1.0,
+        _pmax.u - _prjOrig.u, _pmax.v - _prjOrig.v, 0.0,   1.0, 1.0,
+        _pmax.u - _prjOrig.u, _pmin.v - _prjOrig.v, 0.0,   1.0, 0.0
     };
 
     glEnableVertexAttribArray(_aUV);
@@ -6701,7 +8016,7 @@ int        S52_GL_drawFBPixels(void)
     glFrontFace(GL_CCW);
 
     // turn OFF 'sampler2d'
-    glUniform1f(_uBlitOn, 0.0);
+    _glUseShader(SH_PLAIN);
 
     glDisableVertexAttribArray(_aUV);
     glDisableVertexAttribArray(_aPosition);
@@ -6745,13 +8060,13 @@ int        S52_GL_drawBlit(double scale_x, double scale_y, double scale_z, doubl
 
 #ifdef S52_USE_GL2
     // turn ON 'sampler2d'
-    glUniform1f(_uBlitOn, 1.0);
+    _glUseShader(SH_BLIT);
 
     GLfloat ppt[4*3 + 4*2] = {
-        _pmin.u, _pmin.v, 0.0,   0.0 + scale_x + scale_z, 0.0 + scale_y + scale_z,
-        _pmin.u, _pmax.v, 0.0,   0.0 + scale_x + scale_z, 1.0 + scale_y - scale_z,
-        _pmax.u, _pmax.v, 0.0,   1.0 + scale_x - scale_z, 1.0 + scale_y - scale_z,
-        _pmax.u, _pmin.v, 0.0,   1.0 + scale_x - scale_z, 0.0 + scale_y + scale_z
+        _pmin.u - _prjOrig.u, _pmin.v - _prjOrig.v, 0.0,   0.0 + scale_x + scale_z, 0.0 + scale_y + scale_z,
+        _pmin.u - _prjOrig.u, _pmax.v - _prjOrig.v, 0.0,   0.0 + scale_x + scale_z, 1.0 + scale_y - scale_z,
+        _pmax.u - _prjOrig.u, _pmax.v - _prjOrig.v, 0.0,   1.0 + scale_x - scale_z, 1.0 + scale_y - scale_z,
+        _pmax.u - _prjOrig.u, _pmin.v - _prjOrig.v, 0.0,   1.0 + scale_x - scale_z, 0.0 + scale_y + scale_z
     };
 
     glEnableVertexAttribArray(_aUV);
@@ -6767,7 +8082,7 @@ int        S52_GL_drawBlit(double scale_x, double scale_y, double scale_z, doubl
     glFrontFace(GL_CCW);
 
     // turn OFF 'sampler2d'
-    glUniform1f(_uBlitOn, 0.0);
+    _glUseShader(SH_PLAIN);
     glDisableVertexAttribArray(_aUV);
     glDisableVertexAttribArray(_aPosition);
 
@@ -6786,19 +8101,538 @@ int        S52_GL_drawBlit(double scale_x, double scale_y, double scale_z, doubl
     return TRUE;
 }
 
+//-----------------------------------
+//
+// TILE CACHE SECTION
+//
+//-----------------------------------
+
+#ifdef S52_USE_GL2
+static guint     _tile_hash(gconstpointer key)
+{
+    const _tile_key *k = (const _tile_key *)key;
+
+    return (guint)(k->x * 73856093) ^ (guint)(k->y * 19349663) ^ k->settings;
+}
+
+static gboolean  _tile_equal(gconstpointer a, gconstpointer b)
+{
+    const _tile_key *A = (const _tile_key *)a;
+    const _tile_key *B = (const _tile_key *)b;
+
+    return (A->x==B->x && A->y==B->y && A->settings==B->settings &&
+            A->scalex==B->scalex && A->scaley==B->scaley) ? TRUE : FALSE;
+}
+
+static void      _tile_free(gpointer data)
+{
+    _tile_t *t = (_tile_t *)data;
+
+    if (0 != t->texID)
+        glDeleteTextures(1, &t->texID);
+
+    g_free(t);
+}
+
+static _tile_t  *_tile_new(_tile_key *key, guint maxTiles)
+// new tile, recycle the least recently used if over budget
+{
+    _tile_t *t = NULL;
+
+    if (g_hash_table_size(_tileCache) >= maxTiles) {
+        GHashTableIter iter;
+        gpointer       value;
+        g_hash_table_iter_init(&iter, _tileCache);
+        while (TRUE == g_hash_table_iter_next(&iter, NULL, &value)) {
+            _tile_t *lru = (_tile_t *)value;
+            // tile of this frame can't go
+            if (lru->lastUsed == _tileFrame)
+                continue;
+            if ((NULL==t) || (lru->lastUsed < t->lastUsed))
+                t = lru;
+        }
+
+        if (NULL != t) {
+            // keep the texture - same size
+            g_hash_table_steal(_tileCache, &t->key);
+        } else {
+            PRINTF("WARNING: tile cache budget too small for the view\n");
+        }
+    }
+
+    if (NULL == t)
+        t = g_new0(_tile_t, 1);
+
+    t->key   = *key;
+    t->valid = FALSE;
+    g_hash_table_insert(_tileCache, &t->key, t);
+
+    return t;
+}
+
+static int       _tile_setTarget(_tile_t *t)
+// render to this tile - save the screen view and set the view to the tile
+{
+    if (0 == t->texID) {
+        glGenTextures(1, &t->texID);
+        glBindTexture(GL_TEXTURE_2D, t->texID);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S,     GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T,     GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, S52_TILE_PX, S52_TILE_PX, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, _tileFBO);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, t->texID, 0);
+    if (GL_FRAMEBUFFER_COMPLETE != glCheckFramebufferStatus(GL_FRAMEBUFFER)) {
+        PRINTF("ERROR: tile FBO not complete\n");
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        g_assert(0);
+        return FALSE;
+    }
+
+    _glMatrixDel(VP_PRJ);
+
+    _tileSave_pmin = _pmin;
+    _tileSave_pmax = _pmax;
+    _tileSave_gmin = _gmin;
+    _tileSave_gmax = _gmax;
+    _tileSave_vp   = _vp;
+
+    // same MPP as the screen - symbol and line are the same size
+    double tw = S52_TILE_PX * _scalex;
+    double th = S52_TILE_PX * _scaley;
+    _pmin.u = t->key.x * tw;
+    _pmin.v = t->key.y * th;
+    _pmax.u = _pmin.u  + tw;
+    _pmax.v = _pmin.v  + th;
+    _gmin   = S57_prj2geo(_pmin);
+    _gmax   = S57_prj2geo(_pmax);
+    {
+        projUV pad1 = {_pmin.u - tw, _pmin.v - th};
+        projUV pad2 = {_pmax.u + tw, _pmax.v + th};
+        _tilePad_gmin = S57_prj2geo(pad1);
+        _tilePad_gmax = S57_prj2geo(pad2);
+    }
+    _vp.x   = 0;
+    _vp.y   = 0;
+    _vp.w   = S52_TILE_PX;
+    _vp.h   = S52_TILE_PX;
+
+    glViewport(0, 0, S52_TILE_PX, S52_TILE_PX);
+    _glMatrixSet(VP_PRJ);
+
+    // tile must be opaque - same background as S52_GL_begin()
+    _renderAC_NODATA_layer0();
+    if (1.0 == S52_MP_get(S52_MAR_DISP_NODATA_LAYER))
+        _renderAP_NODATA_layer0();
+
+    _tileCrnt = t;
+
+    _checkError("_tile_setTarget()");
+
+    return TRUE;
+}
+
+static int       _tile_doneTarget(void)
+// back to the screen view
+{
+#ifdef S52_USE_GL3
+    // sounding of this tile
+    _flushSND_gl3();
+#endif
+
+#ifdef S52_USE_FREETYPE_GL
+    // text of this tile
+    _flushTXTAA_gl2();
+#endif
+
+    _glMatrixDel(VP_PRJ);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    _pmin = _tileSave_pmin;
+    _pmax = _tileSave_pmax;
+    _gmin = _tileSave_gmin;
+    _gmax = _tileSave_gmax;
+    _vp   = _tileSave_vp;
+
+    glViewport(_vp.x, _vp.y, _vp.w, _vp.h);
+    _glMatrixSet(VP_PRJ);
+
+    _tileCrnt->valid = TRUE;
+    _tileCrnt        = NULL;
+
+    _checkError("_tile_doneTarget()");
+
+    return TRUE;
+}
+#endif  // S52_USE_GL2
+
+int        S52_GL_tileBegin(void)
+// collect the tiles of the view, TRUE if the view is composited from tiles
+{
+#ifdef S52_USE_GL2
+    _tileIdx   = 0;
+    _tileCrnt  = NULL;
+    _nTileHit  = 0;
+    _nTileMiss = 0;
+
+    // mariner obj (layer 0-8) that change: new extent
+    if (NULL != _tileDirtyObj) {
+        GHashTableIter iter;
+        gpointer       key;
+        g_hash_table_iter_init(&iter, _tileDirtyObj);
+        while (TRUE == g_hash_table_iter_next(&iter, &key, NULL))
+            _tileAddDirty((S52_obj *)key);
+        g_hash_table_remove_all(_tileDirtyObj);
+    }
+
+    if ((TRUE==_tileFlush) && (NULL!=_tileCache)) {
+        g_hash_table_remove_all(_tileCache);
+    }
+    _tileFlush = FALSE;
+
+    // render again the tiles over the old / new extent of those obj
+    // (padded by a tile - symbol / text reach, same as _tileIsOFF())
+    if ((NULL!=_tileDirtyExt) && (0<_tileDirtyExt->len)) {
+        if (NULL != _tileCache) {
+            GHashTableIter iter;
+            gpointer       value;
+            g_hash_table_iter_init(&iter, _tileCache);
+            while (TRUE == g_hash_table_iter_next(&iter, NULL, &value)) {
+                _tile_t *t  = (_tile_t *)value;
+                double   tw = S52_TILE_PX * t->key.scalex;
+                double   th = S52_TILE_PX * t->key.scaley;
+                double   x1 = (t->key.x - 1) * tw;
+                double   y1 = (t->key.y - 1) * th;
+                double   x2 = (t->key.x + 2) * tw;
+                double   y2 = (t->key.y + 2) * th;
+
+                for (guint i=0; i<_tileDirtyExt->len; i+=4) {
+                    double *e = &g_array_index(_tileDirtyExt, double, i);
+                    if (!((e[2] < x1) || (e[0] > x2) || (e[3] < y1) || (e[1] > y2))) {
+                        t->valid = FALSE;
+                        break;
+                    }
+                }
+            }
+        }
+        g_array_set_size(_tileDirtyExt, 0);
+    }
+
+    double mb = S52_MP_get(S52_MAR_DISP_TILE_CACHE);
+    if (0.0 == mb) {
+        // free GPU mem
+        if ((NULL!=_tileCache) && (0 < g_hash_table_size(_tileCache)))
+            g_hash_table_remove_all(_tileCache);
+        return FALSE;
+    }
+
+    if (S52_GL_DRAW != _crnt_GL_cycle)
+        return FALSE;
+
+    // tile are axis aligned
+    if (0.0 != _north)
+        return FALSE;
+
+    // RADAR change every frame
+    if (1.0 == S52_MP_get(S52_MAR_DISP_RADAR_LAYER))
+        return FALSE;
+
+    if (NULL == _tileCache) {
+        _tileCache = g_hash_table_new_full(_tile_hash, _tile_equal, NULL, _tile_free);
+        _tileView  = g_ptr_array_new();
+        glGenFramebuffers(1, &_tileFBO);
+    }
+
+    ++_tileFrame;
+    g_ptr_array_set_size(_tileView, 0);
+
+    guint maxTiles = MAX(1, (guint)(mb * 1024.0 * 1024.0 / (S52_TILE_PX * S52_TILE_PX * 4)));
+
+    _tile_key key;
+    memset(&key, 0, sizeof(_tile_key));
+    key.scalex   = _scalex;
+    key.scaley   = _scaley;
+    // tile of other settings stay in the cache (ex day/night palette)
+    key.settings = S52_MP_getHash();   // only the param that change the image
+
+    double tw = S52_TILE_PX * _scalex;
+    double th = S52_TILE_PX * _scaley;
+    gint64 x1 = (gint64)floor(_pmin.u / tw);
+    gint64 y1 = (gint64)floor(_pmin.v / th);
+    gint64 x2 = (gint64)floor(_pmax.u / tw);
+    gint64 y2 = (gint64)floor(_pmax.v / th);
+
+    for (key.y=y1; key.y<=y2; ++key.y) {
+        for (key.x=x1; key.x<=x2; ++key.x) {
+            _tile_t *t = (_tile_t *)g_hash_table_lookup(_tileCache, &key);
+            if (NULL == t) {
+                t = _tile_new(&key, maxTiles);
+                ++_nTileMiss;
+            } else {
+                ++_nTileHit;
+            }
+            t->lastUsed = _tileFrame;
+            g_ptr_array_add(_tileView, t);
+        }
+    }
+
+    // edge tile reach past the screen - cull (and draw) over the union of the tiles
+    // so that a tile is complete when it is reused by an other view
+    _tileScr_pmin = _pmin;
+    _tileScr_pmax = _pmax;
+    _tileScr_gmin = _gmin;
+    _tileScr_gmax = _gmax;
+
+    _pmin.u = x1 * tw;
+    _pmin.v = y1 * th;
+    _pmax.u = (x2 + 1) * tw;
+    _pmax.v = (y2 + 1) * th;
+    _gmin   = S57_prj2geo(_pmin);
+    _gmax   = S57_prj2geo(_pmax);
+
+    return TRUE;
+#else
+    return FALSE;
+#endif
+}
+
+int        S52_GL_tileNext(void)
+// set the next missing tile as render target
+// return FALSE when all the tiles of the view are rendered
+{
+#ifdef S52_USE_GL2
+    if (NULL != _tileCrnt)
+        _tile_doneTarget();
+
+    while (_tileIdx < _tileView->len) {
+        _tile_t *t = (_tile_t *)g_ptr_array_index(_tileView, _tileIdx++);
+        if (FALSE == t->valid) {
+            if (TRUE == _tile_setTarget(t))
+                return TRUE;
+        }
+    }
+#endif
+
+    return FALSE;
+}
+
+int        S52_GL_tileEnd(void)
+// draw the tiles of the view on screen
+{
+#ifdef S52_USE_GL2
+    // back to the screen view
+    _pmin = _tileScr_pmin;
+    _pmax = _tileScr_pmax;
+    _gmin = _tileScr_gmin;
+    _gmax = _tileScr_gmax;
+    _glMatrixDel(VP_PRJ);
+    _glMatrixSet(VP_PRJ);
+
+    // turn ON 'sampler2d'
+    _glUseShader(SH_BLIT);
+
+    glEnableVertexAttribArray(_aUV);
+    glEnableVertexAttribArray(_aPosition);
+
+    glFrontFace(GL_CW);
+
+    double tw = S52_TILE_PX * _scalex;
+    double th = S52_TILE_PX * _scaley;
+    for (guint i=0; i<_tileView->len; ++i) {
+        _tile_t *t = (_tile_t *)g_ptr_array_index(_tileView, i);
+
+        // tile fail to render
+        if (FALSE == t->valid)
+            continue;
+
+        GLfloat x1 = t->key.x * tw - _prjOrig.u;
+        GLfloat y1 = t->key.y * th - _prjOrig.v;
+        GLfloat x2 = x1 + tw;
+        GLfloat y2 = y1 + th;
+        GLfloat ppt[4*3 + 4*2] = {
+            x1, y1, 0.0,   0.0, 0.0,
+            x1, y2, 0.0,   0.0, 1.0,
+            x2, y2, 0.0,   1.0, 1.0,
+            x2, y1, 0.0,   1.0, 0.0
+        };
+
+        glBindTexture(GL_TEXTURE_2D, t->texID);
+
+        glVertexAttribPointer(_aUV,       2, GL_FLOAT, GL_FALSE, 5 * sizeof(GLfloat), &ppt[3]);
+        glVertexAttribPointer(_aPosition, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(GLfloat), ppt);
+
+        glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+    }
+
+    glFrontFace(GL_CCW);
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    // turn OFF 'sampler2d'
+    _glUseShader(SH_PLAIN);
+    glDisableVertexAttribArray(_aUV);
+    glDisableVertexAttribArray(_aPosition);
+
+    _checkError("S52_GL_tileEnd()");
+#endif
+
+    return TRUE;
+}
+
+int        S52_GL_resetTileCache(void)
+// scene changed (cell load, PLib, ..) - Mariners' Param are in the key
+{
+#ifdef S52_USE_GL2
+    // GL call only inside a GL cycle
+    _tileFlush = TRUE;
+#endif
+
+    return TRUE;
+}
+
 #include "gdal.h"  // GDAL stuff to write .PNG
+static int       _dumpEncode(_dumpJob *job)
+// flip and write pixels to file - worker thread, no GL call here
+{
+    GDALDriverH  driver  = NULL;
+    GDALDatasetH dataset = NULL;
+    guint        w       = job->w;
+    guint        h       = job->h;
+    guint        nc      = job->nc;
+
+    if (FALSE == job->ret)
+        return FALSE;
+
+    //FIXME: use something like glPixelStorei(gl.UNPACK_FLIP_Y_WEBGL, true);
+    {   // flip vertically
+        guint8 *flipbuf = g_new0(guint8, w * h * nc);
+        for (guint i=0; i<h; ++i) {
+            memcpy(flipbuf + ((h-1) - i) * w * nc,
+                   job->pixels + (i * w * nc),
+                   w * nc);
+        }
+        g_free(job->pixels);
+        job->pixels = flipbuf;
+    }
+
+    // in memory - no temp file on disk
+    driver = GDALGetDriverByName("MEM");
+    if (NULL == driver) {
+        PRINTF("WARNING: fail to get GDAL driver\n");
+        return FALSE;
+    }
+    dataset = GDALCreate(driver, "", w, h, 3, GDT_Byte, NULL);
+    if (NULL == dataset) {
+        PRINTF("WARNING: fail to create GDAL data set\n");
+        return FALSE;
+    }
+    GDALRasterBandH bandR = GDALGetRasterBand(dataset, 1);
+    GDALRasterBandH bandG = GDALGetRasterBand(dataset, 2);
+    GDALRasterBandH bandB = GDALGetRasterBand(dataset, 3);
+
+    // skip alpha if any
+    GDALRasterIO(bandR, GF_Write, 0, 0, w, h, job->pixels+0, w, h, GDT_Byte, nc, 0);
+    GDALRasterIO(bandG, GF_Write, 0, 0, w, h, job->pixels+1, w, h, GDT_Byte, nc, 0);
+    GDALRasterIO(bandB, GF_Write, 0, 0, w, h, job->pixels+2, w, h, GDT_Byte, nc, 0);
+
+    GDALDatasetH dst_dataset;
+    // PNG, WebP (tile) or GeoTIFF
+    if (TRUE == g_str_has_suffix(job->fname, ".webp"))
+        driver  = GDALGetDriverByName("WEBP");
+    else
+        if (TRUE == g_str_has_suffix(job->fname, ".tif"))
+            driver  = GDALGetDriverByName("GTiff");
+        else
+            driver  = GDALGetDriverByName("PNG");
+    if (NULL == driver) {
+        PRINTF("WARNING: no GDAL driver for %s\n", job->fname);
+        GDALClose(dataset);
+        return FALSE;
+    }
+    dst_dataset = GDALCreateCopy(driver, job->fname, dataset, FALSE, NULL, NULL, NULL);
+    if (NULL == dst_dataset) {
+        PRINTF("WARNING: fail to write %s\n", job->fname);
+        GDALClose(dataset);
+        return FALSE;
+    }
+    GDALClose(dst_dataset);
+    GDALClose(dataset);
+
+    return TRUE;
+}
+
+static void      _dumpWorker(gpointer data, gpointer user_data)
+{
+    (void)user_data;
+
+    _dumpJob *job = (_dumpJob *)data;
+    job->ret = _dumpEncode(job);
+
+    g_async_queue_push(_dumpDone, job);
+
+    return;
+}
+
+static int       _dumpPush(_dumpJob *job)
+// pixels in main mem - send to the encoder
+{
+    ++_dumpNbr;
+    g_thread_pool_push(_dumpPool, job, NULL);
+
+    return TRUE;
+}
+
+static int       _dumpReap(int wait)
+// free job encoded - wait for all if 'wait' is TRUE
+{
+    while (0 < _dumpNbr) {
+        _dumpJob *job = (TRUE==wait) ? (_dumpJob *)g_async_queue_pop    (_dumpDone):
+                                       (_dumpJob *)g_async_queue_try_pop(_dumpDone);
+        if (NULL == job)
+            break;
+
+        --_dumpNbr;
+
+        // debug
+        //PRINTF("DEBUG: dump %s %s\n", job->fname, (TRUE==job->ret)?"done":"FAILED");
+
+        g_free(job->fname);
+        g_free(job->pixels);
+        g_free(job);
+    }
+
+    return TRUE;
+}
+
+int        S52_GL_dumpSync(void)
+{
+#ifdef S52_USE_GL3
+    _pboResolve_gl3(TRUE);
+#endif
+    _dumpReap(TRUE);
+
+    return TRUE;
+}
+
 int        S52_GL_dumpS57IDPixels(const char *toFilename, S52_obj *obj, unsigned int width, unsigned int height)
 // FIXME: width/height rounding error all over - fix: +0.5
 // to test 2 PNG using Python Imaging Library (PIL):
 // FIXME: move GDAL stuff to S52.c (and remove gdal.h)
 {
-    GDALDriverH  driver  = NULL;
-    GDALDatasetH dataset = NULL;
-
     return_if_null(toFilename);
 
-    GDALAllRegister();
+    if (NULL == _dumpPool) {
+        GDALAllRegister();
 
+        // one thread - keep dump in order
+        _dumpDone = g_async_queue_new();
+        _dumpPool = g_thread_pool_new(_dumpWorker, NULL, 1, FALSE, NULL);
+    }
 
     // if obj is NULL then dump the whole framebuffer
     guint x, y;
@@ -6841,76 +8675,42 @@ int        S52_GL_dumpS57IDPixels(const char *toFilename, S52_obj *obj, unsigned
         if ((y    + height  ) >  _vp.h) y = _vp.h - height;
     }
 
-    driver = GDALGetDriverByName("GTiff");
-    if (NULL == driver) {
-        PRINTF("WARNING: fail to get GDAL driver\n");
-        return FALSE;
-    }
-
-    /* debug
-    char **papszMetadata = GDALGetMetadata(driver, NULL);
-    int i = 0;
-    while (NULL != papszMetadata[i]) {
-        PRINTF("papszMetadata[%i] = %s\n", i, papszMetadata[i]);
-        ++i;
-    }
-    //if( CSLFetchBoolean( papszMetadata, GDAL_DCAP_CREATE, FALSE ) )
-    */
+    _dumpJob *job = g_new0(_dumpJob, 1);
+    job->fname    = g_strdup(toFilename);
+    job->w        = width;
+    job->h        = height;
+    job->ret      = TRUE;
 
-#ifdef S52_USE_ANDROID
-    char *tmpTif = "/sdcard/s52droid/_tmp.tif";
-#else
-    char *tmpTif = "_tmp.tif";
+#ifdef S52_USE_GL3
+    // read in a PBO, job land in the encoder when the GPU is done (see S52_GL_end())
+    job->nc     = _RGBA;
+    job->pixels = g_new0(guint8, width * height * job->nc);
+    if (TRUE == _pboRead_gl3(x, y, job))
+        return TRUE;
 #endif
 
-    dataset = GDALCreate(driver, tmpTif, width, height, 3, GDT_Byte, NULL);
-    if (NULL == dataset) {
-        PRINTF("WARNING: fail to create GDAL data set\n");
-        return FALSE;
-    }
-    GDALRasterBandH bandR = GDALGetRasterBand(dataset, 1);
-    GDALRasterBandH bandG = GDALGetRasterBand(dataset, 2);
-    GDALRasterBandH bandB = GDALGetRasterBand(dataset, 3);
-
     // get framebuffer pixels
-    guint8 *pixels = g_new0(guint8, width * height * _fb_format);
+    job->nc     = _RGB;
+    job->pixels = g_renew(guint8, job->pixels, width * height * job->nc);
 
 #ifdef S52_USE_GL2
     // FIXME: arm adreno will break here
-    glReadPixels(x, y, width, height, GL_RGB, GL_UNSIGNED_BYTE, pixels);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(x, y, width, height, GL_RGB, GL_UNSIGNED_BYTE, job->pixels);
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
     //glReadPixels(x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
 #else
     glReadBuffer(GL_FRONT);
-    glReadPixels(x, y, width, height, GL_RGB, GL_UNSIGNED_BYTE, pixels);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(x, y, width, height, GL_RGB, GL_UNSIGNED_BYTE, job->pixels);
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
     glReadBuffer(GL_BACK);
 #endif
 
     _checkError("S52_GL_dumpS57IDPixels()");
 
-    //FIXME: use something like glPixelStorei(gl.UNPACK_FLIP_Y_WEBGL, true);
-    {   // flip vertically
-        guint8 *flipbuf = g_new0(guint8, width * height * 3);
-        for (guint i=0; i<height; ++i) {
-            memcpy(flipbuf + ((height-1) - i) * width * 3,
-                   pixels + (i * width * 3),
-                   width * 3);
-        }
-        g_free(pixels);
-        pixels = flipbuf;
-    }
-
-    // write to temp file
-    GDALRasterIO(bandR, GF_Write, 0, 0, width, height, pixels+0, width, height, GDT_Byte, 3, 0 );
-    GDALRasterIO(bandG, GF_Write, 0, 0, width, height, pixels+1, width, height, GDT_Byte, 3, 0 );
-    GDALRasterIO(bandB, GF_Write, 0, 0, width, height, pixels+2, width, height, GDT_Byte, 3, 0 );
-
-    GDALClose(dataset);
-    g_free(pixels);
-
-    GDALDatasetH dst_dataset;
-    driver      = GDALGetDriverByName("PNG");
-    dst_dataset = GDALCreateCopy(driver, toFilename, GDALOpen(tmpTif, GA_ReadOnly), FALSE, NULL, NULL, NULL);
-    GDALClose(dst_dataset);
+    // encode in background
+    _dumpPush(job);
 
     return TRUE;
 }
@@ -6946,6 +8746,9 @@ int        S52_GL_drawStr(double pixels_x, double pixels_y, const char *colorNam
 
     _glMatrixSet(VP_PRJ);
     _renderTXTAA(NULL, c, pixels_x, pixels_y, bsize, 1, str);
+#ifdef S52_USE_FREETYPE_GL
+    _flushTXTAA_gl2();
+#endif
     _glMatrixDel(VP_PRJ);
 
 #else  // S52_USE_GL2
@@ -7011,7 +8814,7 @@ int        S52_GL_drawGraticule(void)
     {
         double lat  = _pmin.v + dlat;
         double lon  = _pmin.u;
-        pt3v ppt[2] = {{lon, lat, 0.0}, {_pmax.u, lat, 0.0}};
+        pt3v ppt[2] = {{lon - _prjOrig.u, lat - _prjOrig.v, 0.0}, {_pmax.u - _prjOrig.u, lat - _prjOrig.v, 0.0}};
         projXY uv   = {lon, lat};
 
         uv = S57_prj2geo(uv);
@@ -7025,7 +8828,7 @@ int        S52_GL_drawGraticule(void)
     {
         double lat  = _pmin.v + dlat + dlat;
         double lon  = _pmin.u;
-        pt3v ppt[2] = {{lon, lat, 0.0}, {_pmax.u, lat, 0.0}};
+        pt3v ppt[2] = {{lon - _prjOrig.u, lat - _prjOrig.v, 0.0}, {_pmax.u - _prjOrig.u, lat - _prjOrig.v, 0.0}};
         projXY uv   = {lon, lat};
         uv = S57_prj2geo(uv);
         SNPRINTF(str, 80, "%07.4f deg %c", fabs(uv.v), (0.0<lat)?'N':'S');
@@ -7039,7 +8842,7 @@ int        S52_GL_drawGraticule(void)
     {
         double lat  = _pmin.v;
         double lon  = _pmin.u + dlon;
-        pt3v ppt[2] = {{lon, lat, 0.0}, {lon, _pmax.v, 0.0}};
+        pt3v ppt[2] = {{lon - _prjOrig.u, lat - _prjOrig.v, 0.0}, {lon - _prjOrig.u, _pmax.v - _prjOrig.v, 0.0}};
         projXY uv   = {lon, lat};
         uv = S57_prj2geo(uv);
         SNPRINTF(str, 80, "%07.4f deg %c", fabs(uv.u), (0.0<lon)?'E':'W');
@@ -7052,7 +8855,7 @@ int        S52_GL_drawGraticule(void)
     {
         double lat  = _pmin.v;
         double lon  = _pmin.u + dlon + dlon;
-        pt3v ppt[2] = {{lon, lat, 0.0}, {lon, _pmax.v, 0.0}};
+        pt3v ppt[2] = {{lon - _prjOrig.u, lat - _prjOrig.v, 0.0}, {lon - _prjOrig.u, _pmax.v - _prjOrig.v, 0.0}};
         projXY uv   = {lon, lat};
         uv = S57_prj2geo(uv);
         SNPRINTF(str, 80, "%07.4f deg %c", fabs(uv.u), (0.0<lon)?'E':'W');
@@ -7184,7 +8987,7 @@ int              _drawArc(S52_obj *objA, S52_obj *objB)
         for (int j=0; j<=nSym; ++j) {
             _glLoadIdentity(GL_MODELVIEW);
 
-            _glTranslated(xx, yy, 0.0);
+            _glTranslatedPRJ(xx, yy, 0.0);
 
             _glRotated(90.0-crntAngle, 0.0, 0.0, 1.0);
             // FIXME: radius too long (maybe because of symb width!)
@@ -7285,12 +9088,8 @@ int        S52_GL_isHazard(int nxyz, double *xyz)
     // Starboard
     //_intersect(x1, y1, x2, y2, x3, y3, x4, y4);
 
-#ifdef S52_USE_GL2
-    _d2f(_tessWorkBuf_f, nxyz, xyz);
-    memcpy(_hazardZone, _tessWorkBuf_f->data, sizeof(vertex_t) * nxyz * 3);
-#else
-    memcpy(_hazardZone, xyz, sizeof(vertex_t) * nxyz * 3);
-#endif
+    // keep in double - GPU origin move with the view
+    memcpy(_hazardZone, xyz, sizeof(double) * nxyz * 3);
 
     // highlight Hazard
     int found = FALSE;
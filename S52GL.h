@@ -94,21 +94,48 @@ int   S52_GL_setDotPitch(int w, int h, int wmm, int hmm);
 int   S52_GL_begin(S52_GL_cycle cycle);
 // render an object to framebuffer
 int   S52_GL_draw(S52_obj *obj, gpointer user_data);
+// GL pipeline state of the first command of an object (sort key of the journal)
+guint64 S52_GL_getStateKey(S52_obj *obj);
 // draw lights
 int   S52_GL_drawLIGHTS(S52_obj *obj);
+// batch the sector arc of the lights drawn between Beg / End (DRAW cycle, GL2)
+int   S52_GL_lightsBeg(void);
+int   S52_GL_lightsEnd(void);
 // draw text
 int   S52_GL_drawText(S52_obj *obj, gpointer user_data);
+// draw the text batch (GL2), at the end of each cell
+int   S52_GL_drawTextEnd(void);
+// declutter - place point symbol in the occupancy grid (call in display priority order, before draw)
+int   S52_GL_declutterSY(S52_obj *obj, gpointer user_data);
+// declutter - flush grid and cached placement at next DRAW
+int   S52_GL_resetDeclutter(void);
+
+// tile cache - TRUE if the view is composited from tiles (S52_MAR_DISP_TILE_CACHE)
+// Note: call before cull, the PRJ view is then the union of the tiles until S52_GL_tileEnd()
+int   S52_GL_tileBegin(void);
+// TRUE if a missing tile is set as render target (draw the scene then call again)
+int   S52_GL_tileNext(void);
+// composite all tiles of the view
+int   S52_GL_tileEnd(void);
+// flush all tiles at next DRAW (cell load, PLib, ..)
+int   S52_GL_resetTileCache(void);
 // draw RADAR,Bathy,...
 int   S52_GL_drawRaster(S52_GL_ras *raster);
 
 // copy from framebuffer to memory (or texture), return pixels
 unsigned
 char *S52_GL_readFBPixels(void);
-// debug
+// debug - file written in background (GL3: pixels read one frame later)
 int   S52_GL_dumpS57IDPixels(const char *toFilename, S52_obj *obj, unsigned int width, unsigned int height);
+// wait for all dump to be written
+int   S52_GL_dumpSync(void);
 
 // copy from memory to frame buffer
 int   S52_GL_drawFBPixels(void);
+// dirty rectangle: flag a mariner obj that change (NULL: all the view), drawLast() restore only its area
+int   S52_GL_setDirty(S52_obj *obj);
+// dirty rectangle: TRUE if obj must be redrawn by this drawLast() (changed or overlap a restored area)
+int   S52_GL_isDirty(S52_obj *obj);
 int   S52_GL_drawBlit(double scale_x, double scale_y, double scale_z, double north);
 
 // done frame, restore OpenGL state
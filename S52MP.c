@@ -26,6 +26,7 @@
 #include "S52utils.h"   // PRINTF()
 
 #include <glib.h>       // TRUE, FALSE
+#include <string.h>     // memcpy()
 
 ///////////////////////////////////////////////////////////////////
 //
@@ -210,15 +211,50 @@ static double _MARparamVal[] = {
 
     0.0,      // 49 - S52_MAR_DISP_HODATA, 0 - union HO data limit "m_covr" (default), 1 - all HO data limit (M_COVR+m_covr)
 
-    50.0      // number of parameter type
+    0.0,      // 50 - S52_MAR_DISP_DECLUTTER, 0 - off (default), 1 - text, 2 - text + point symbol
+
+    0.0,      // 51 - S52_MAR_DISP_TILE_CACHE, 0 - off (default), N - GPU budget (MB) of the tile cache
+
+    0.0,      // 52 - S52_MAR_DISP_STATE_SORT, 0 - off (default), 1 - sort obj by GL state inside a display priority
+
+    0.0,      // 53 - S52_MAR_DISP_CULL_THREAD, 0 - off (default), N - number of worker thread that cull the cells
+
+    0.0,      // 54 - S52_MAR_DISP_DIRTY_RECT, 0 - off (default), 1 - drawLast() restore / redraw only the area of mariner obj that change
+
+    0.0,      // 55 - S52_MAR_CS_THREAD, 0 - off (default), N - number of worker thread that resolve the CS of the cells
+
+    56.0      // number of parameter type
 };
 
+// CS dependency - Mariner's Param read between S52_MP_depBeg() / S52_MP_depEnd()
+// per thread, CS can be resolved in a thread pool (S52_MAR_CS_THREAD)
+typedef struct _depState {
+    int     on;
+    guint64 mask;
+} _depState;
+#if (defined(S52_USE_ANDROID) || defined(_MINGW))
+static GStaticPrivate _depKey = G_STATIC_PRIVATE_INIT;
+#define DEPKEYGET()   g_static_private_get(&_depKey)
+#define DEPKEYSET(d)  g_static_private_set(&_depKey, d, g_free)
+#else
+static GPrivate       _depKey = G_PRIVATE_INIT(g_free);
+#define DEPKEYGET()   g_private_get(&_depKey)
+#define DEPKEYSET(d)  g_private_set(&_depKey, d)
+#endif
+static gint           _depNbr = 0;   // nbr of thread recording - skip DEPKEYGET() at render time
+
 double S52_MP_get(S52MarinerParameter param)
 // return Mariner parameter or S52_MAR_ERROR if fail
 // FIXME: check mariner param against groups selection
 {
     //if (param<S52_MAR_ERROR || S52_MAR_NUM<=param) {
     if (S52_MAR_ERROR<=param && param<S52_MAR_NUM) {
+        if (0 != g_atomic_int_get(&_depNbr)) {
+            _depState *dep = (_depState *)DEPKEYGET();
+            if ((NULL!=dep) && (TRUE==dep->on))
+                dep->mask |= S52_MP_BIT(param);
+        }
+
         return _MARparamVal[param];
     } else {
         PRINTF("WARNING: param invalid(%f)\n", param);
@@ -244,6 +280,36 @@ int    S52_MP_set(S52MarinerParameter param, double val)
     }
 }
 
+int    S52_MP_depBeg(void)
+{
+    _depState *dep = (_depState *)DEPKEYGET();
+    if (NULL == dep) {
+        dep = g_new0(_depState, 1);
+        DEPKEYSET(dep);
+    }
+
+    if (FALSE == dep->on)
+        g_atomic_int_inc(&_depNbr);
+
+    dep->on   = TRUE;
+    dep->mask = 0;
+
+    return TRUE;
+}
+
+guint64 S52_MP_depEnd(void)
+{
+    _depState *dep = (_depState *)DEPKEYGET();
+    if ((NULL==dep) || (FALSE==dep->on)) {
+        PRINTF("WARNING: S52_MP_depBeg() not called\n");
+        return 0;
+    }
+
+    dep->on = FALSE;
+    g_atomic_int_add(&_depNbr, -1);
+
+    return dep->mask;
+}
 
 // ------ Text Display Priority --------------------------------------------------
 //
@@ -294,3 +360,35 @@ int    S52_MP_getTextDisp(unsigned int prioIdx)
     else
         return -1;
 }
+
+// Mariners' Param that doesn't change the image of S52_draw() (not in S52_MP_getHash())
+// GPU budget, thread, GL state sort, drawLast() restore, alarm output, pick, AIS delay
+#define S52_MP_NOIMAGE (S52_MP_BIT(S52_MAR_ERROR)            | \
+                        S52_MP_BIT(S52_MAR_DISP_TILE_CACHE)  | \
+                        S52_MP_BIT(S52_MAR_DISP_STATE_SORT)  | \
+                        S52_MP_BIT(S52_MAR_DISP_CULL_THREAD) | \
+                        S52_MP_BIT(S52_MAR_DISP_DIRTY_RECT)  | \
+                        S52_MP_BIT(S52_MAR_CS_THREAD)        | \
+                        S52_MP_BIT(S52_MAR_GUARDZONE_ALARM)  | \
+                        S52_MP_BIT(S52_MAR_DISP_CRSR_PICK)   | \
+                        S52_MP_BIT(S52_MAR_DISP_VESSEL_DELAY))
+
+unsigned int S52_MP_getHash(void)
+// djb2 on the Mariners' Param that change the image and text display
+{
+    guint h = 5381;
+
+    for (int i=0; i<S52_MAR_NUM; ++i) {
+        if (0 != (S52_MP_NOIMAGE & S52_MP_BIT(i)))
+            continue;
+
+        guint64 bits = 0;
+        memcpy(&bits, &_MARparamVal[i], sizeof(guint64));
+        h = (h * 33) ^ (guint)(bits ^ (bits >> 32));
+    }
+
+    for (int i=0; i<TEXT_IDX_MAX; ++i)
+        h = (h * 33) ^ _textDisp[i];
+
+    return h;
+}
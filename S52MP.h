@@ -27,11 +27,23 @@
 
 #include "S52.h"   // S52MarinerParameter
 
+#include <glib.h>  // guint64
+
 double S52_MP_get(S52MarinerParameter param);
 int    S52_MP_set(S52MarinerParameter param, double val);
 
+// CS dependency: record the Mariner's Param read by S52_MP_get() between Beg/End
+// (ie by a CS) as a bit mask of S52_MP_BIT() - S52_MAR_NUM must stay <= 64
+#define S52_MP_BIT(param)  (((guint64)1) << (param))
+int     S52_MP_depBeg(void);
+guint64 S52_MP_depEnd(void);
+
 int    S52_MP_setTextDisp(unsigned int prioIdx, unsigned int count, unsigned int state);
 int    S52_MP_getTextDisp(unsigned int prioIdx);
 
+// hash of the display settings that change the image (Mariners' Param + text display)
+// use to key rendered image (tile)
+unsigned int S52_MP_getHash(void);
+
 
 #endif //_S52MP_H_
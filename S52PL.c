@@ -131,7 +131,6 @@ typedef struct _S52_cmdDef {
     S52_DList      DListData;   // GL Display List / VBO
 
 #if (defined(S52_USE_GL2) || defined(S52_USE_GLES2))
-    guint          mask_texID;  // texture ID of pattern after running VBO
     int            potW;        // tex widht
     int            potH;        // tex height
 #endif
@@ -174,16 +173,19 @@ typedef struct _cmdWL {
 
     _cmdDef        cmd;      // command word definition or conditional symb func call
 
-#ifdef S52_USE_FREETYPE_GL
-    guint          vboID;    // ID if the OpenGL VBO text
-    guint          len;      // VBO text length
-#endif
-
     guchar         crntPal;  // optimisation: this 'cmd' is setup for 'palette N' colors
 
     struct _cmdWL *next;
 } _cmdWL;
 
+// parsed instruction list shared by all obj that have the same instruction
+// (LUP INST or CS output) - immutable once parsed (text is parsed in obj->cmdAfinal)
+typedef struct _cmdLshr {
+    GString       *inst;     // instruction - also the key in _cmdLtbl
+    _cmdWL        *cmdL;     // parsed 'inst' (param point into 'inst')
+    guint          ref;      // nbr of obj using this list
+} _cmdLshr;
+
 // S52 lookup table name (fifth letter)
 typedef enum _LUPtnm {
     _LUP_NONAM =  0 , // unknown LUP (META)
@@ -197,6 +199,21 @@ typedef enum _LUPtnm {
 
 
 //-- LOOKUP MODULE STRUCTURE ----------------------------------------
+// ATTC precompiled at load time, one term per attribute name/value pair
+typedef struct _LUPatt {
+    GQuark       q;         // ATTL as a quark (S57 attribute name)
+    guint        idx;       // index of ATTL in the class attribute list (_LUPcls)
+    char         mode;      // ' ' any value, '?' unknown value, '\0' no value, else value
+    int          val;       // atoi() of ATTV
+    const char  *str;       // ATTV --point into ATTC
+} _LUPatt;
+
+// distinct attribute of all the LUP of a class --held by the first LUP of the chain
+typedef struct _LUPcls {
+    guint        natt;
+    GQuark      *attQ;
+} _LUPcls;
+
 typedef struct _LUP {
     int          RCID;          // record identifier
     char         OBCL[S52_PL_NMLN+1]; // LUP name --'\0' terminated
@@ -213,6 +230,9 @@ typedef struct _LUP {
     // ---- not a S52 fields ------------------------------------
     S52_objSupp  supp;      // suppress display of this object type
     struct _LUP *OBCLnext;  // next LUP with name OBCL
+
+    GArray      *attc;      // ATTC compiled - _LUPatt
+    _LUPcls     *cls;       // first LUP of the chain only (see _compileLUPcls())
 } _LUP;
 
 typedef enum _poly_mode {
@@ -258,31 +278,40 @@ typedef enum _table_t {
 } _table_t;
 
 typedef struct _S52_obj {
-    // 2 set of LUP: normal and alternate
-    _LUP        *LUP;           // common data for the 2 set of LUP
+    // --- hot: read by the cull / draw on every frame ---
+    // keep at the start, in as few cache line as possible
+    // Note: still one heap block per obj, the cull follow a pointer per obj (no per-cell array)
+    gboolean     supp;          // display suppression set by user
+    guint        toggleGen;     // _toggleGen when 'toggle' was computed (0 - never)
+    S52_objSupp  toggle;        // cached S52_PL_getObjToggleState()
 
-    _cmdWL      *cmdLorig[2];   // instruction list command (parsed LUP.INST)
+    // CS override
+    int          prioOveride;   // CS overide display priority
+    S52_disPrio  DPRI;          // Display Priority
+    S52_RadPrio  RPRI;          // 'O' or 'S', Radar Priority
+    S52_DisCat   DISC;          // Display Categorie: B/S/O, Base, Standard, Other
 
-    GString     *CSinst[2];     // expanded (resolved) cond. symb. instruction list
-    _cmdWL      *CScmdL[2];     // parsed cond. symb. instruction list command
+    S57_geo     *geoData;       // S-57
+
+    // 2 set of LUP: normal and alternate
+    _LUP        *LUP;           // common data for the 2 set of LUP
 
     // final command list (array):
     // normal command word + those once CS has been resolve and parsed
-    GArray      *cmdAfinal[2];  // command array: normal symbol and alternate
     GArray      *crntA;         // point to the current (active) command array (normal or alternate)
     guint        crntAidx;      // index in command array
-
     gint         textParsed[2]; // TRUE if parsed, need two flag because there is text for
                                 // two type of point and area
-    // CS override
-    int          prioOveride;   // CS overide display priority
-    S52_disPrio  DPRI;          // Display Priority
-    S52_RadPrio  RPRI;          // 'O' or 'S', Radar Priority
-    S52_DisCat   DISC;          // Display Categorie: B/S/O, Base, Standard, Other
+    GArray      *cmdAfinal[2];  // command array: normal symbol and alternate
+
+    // --- cold: (re)load, CS resolve, pick ---
+    _cmdLshr    *cmdLorig[2];   // instruction list command (parsed LUP.INST) - shared
+
+    _cmdLshr    *CScmdL[2];     // expanded (resolved) cond. symb. instruction list, parsed - shared
+
     int          LUCM;          // Look-Up Comment (PLib3.x put 'groupes' here,
                                 // hense 'int', but its a string in the specs)
-
-    S57_geo     *geoData;       // S-57
+    guint64      CSdep;         // Mariner's Param read by the CS (S52_MP_BIT()), last resolve (normal + alternate)
 
     // --- Auxiliary Info --------------------------------
     // FIXME: make that a struct
@@ -295,8 +324,6 @@ typedef struct _S52_obj {
 
     GTimeVal     time;          // store time (use to find age of AIS)
 
-    gboolean     supp;          // display suppression set by user
-
     // LEGLIN
     struct _S52_obj *nextLeg;   // link to next leglin (need to draw arc)
     struct _S52_obj *prevLeg;   // link to previous leg so that we can clip the start of this leg
@@ -309,6 +336,32 @@ typedef struct _S52_obj {
 static gboolean _initPLib       = TRUE;  // will init PLib
 static GTree   *_table[TBL_NUM] = {NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL};
 
+// intern table of parsed instruction list - key: instruction string, value: _cmdLshr
+// Note: CS can be resolved from many thread (S52_MAR_CS_THREAD)
+static GHashTable *_cmdLtbl     = NULL;
+static guint       _cmdLnReq    = 0;     // statistic - nbr of list requested
+static guint       _cmdLnHit    = 0;     // statistic - nbr of list shared
+#ifdef S52_DEBUG
+// look-up rate - _linkLUP() is called under the main mutex (cell load, mariner obj, PLib reload)
+static GTimer     *_LUPtimer    = NULL;
+static guint       _LUPn        = 0;     // statistic - nbr of look-up since S52_PL_statLUP()
+static double      _LUPsec      = 0.0;   // statistic - time in _lookUpLUP() since S52_PL_statLUP()
+#endif
+// toggle state of obj by display category (DISC) and LUP suppression - rebuild by S52_PL_resetToggle()
+// bumping _toggleGen invalidate the toggle state cached in each obj
+static S52_objSupp _toggleTbl[256][S52_SUPP_ERR+1];
+static volatile gint _toggleGen = 0;
+
+#if (defined(S52_USE_ANDROID) || defined(_MINGW))
+static GStaticMutex  _cmdLmutex = G_STATIC_MUTEX_INIT;
+#define GMUTEXLOCK   g_static_mutex_lock
+#define GMUTEXUNLOCK g_static_mutex_unlock
+#else
+static GMutex        _cmdLmutex;
+#define GMUTEXLOCK   g_mutex_lock
+#define GMUTEXUNLOCK g_mutex_unlock
+#endif
+
 #define CR     '\r'      // carriage return
 #define EOL    '\037'    // 31/037/0x1F/CTRL-_: ASCII Unit Separator
                          // used in S52 as an EOL (also ATTC field separator)
@@ -590,6 +643,11 @@ static void       _delLUP(gpointer value)
 
        if (NULL != LUP->ATTC) g_string_free(LUP->ATTC, TRUE);
        if (NULL != LUP->INST) g_string_free(LUP->INST, TRUE);
+       if (NULL != LUP->attc) g_array_free(LUP->attc, TRUE);
+       if (NULL != LUP->cls) {
+           g_free(LUP->cls->attQ);
+           g_free(LUP->cls);
+       }
 
        g_free(LUP);
 
@@ -645,12 +703,85 @@ static int        _dumpATT(char *str)
     return TRUE;
 }
 
+static int        _compileATTC(_LUP *LUP)
+// split ATTC ("ATTLval\0ATTLval\0\0") into quark + pre-decoded value once at load
+// so that _lookUpLUP() doesn't rescan the string for each S57 object
+{
+    char *attlv = LUP->ATTC->str;
+
+    if (NULL != LUP->attc)
+        g_array_free(LUP->attc, TRUE);
+    LUP->attc = g_array_new(FALSE, TRUE, sizeof(_LUPatt));
+
+    while ('\0' != *attlv) {
+        char    attl[7] = {'\0'}; // attribute name
+        _LUPatt att;
+
+        strncat(attl, attlv, 6);
+        att.q    = g_quark_from_string(attl);
+        att.idx  = 0;             // set by _compileLUPcls()
+        att.mode = attlv[6];
+        att.val  = atoi(attlv+6);
+        att.str  = attlv+6;
+
+        g_array_append_val(LUP->attc, att);
+
+        // get next attribute name/value for this LUP
+        attlv += strlen(attlv) + 1;
+    }
+
+    return TRUE;
+}
+
+static gboolean   _compileLUPcls(gpointer key, gpointer value, gpointer data)
+// collect the distinct attribute of all LUP of this class (in the chain head)
+// so that an S57 object attribute is fetched only once per look-up
+{
+    (void)key;
+    (void)data;
+
+    _LUP   *LUPtop = (_LUP*) value;
+    GArray *attQ   = g_array_new(FALSE, FALSE, sizeof(GQuark));
+
+    if (NULL != LUPtop->cls) {
+        g_free(LUPtop->cls->attQ);
+        g_free(LUPtop->cls);
+    }
+
+    for (_LUP *LUP=LUPtop; NULL!=LUP; LUP=LUP->OBCLnext) {
+        if (NULL == LUP->attc)
+            continue;
+
+        for (guint i=0; i<LUP->attc->len; ++i) {
+            _LUPatt *att = &g_array_index(LUP->attc, _LUPatt, i);
+            guint    j   = 0;
+
+            for (j=0; j<attQ->len; ++j) {
+                if (att->q == g_array_index(attQ, GQuark, j))
+                    break;
+            }
+            if (j == attQ->len)
+                g_array_append_val(attQ, att->q);
+
+            att->idx = j;
+        }
+    }
+
+    LUPtop->cls       = g_new0(_LUPcls, 1);
+    LUPtop->cls->natt = attQ->len;
+    LUPtop->cls->attQ = (GQuark*) g_array_free(attQ, FALSE);
+
+    return FALSE;  // continue
+}
+
 static _LUP      *_lookUpLUP(_LUP *LUPlist, S57_geo *geoData)
 // Get the LUP with maximum Object attribute match.
 //
 // Note: reference are maide to section "8.3 How to use the look-up table"
 //       of IHO ECDIS PRESENTATION LIBRARY USER'S MANUAL Ed/Rev 3.2 March 2000
 //       (IHO Special Publication No. 52 ANNEX A of APPENDIX 2 --S52-A-2)
+//
+// Note: ATTC is precompiled at load (_compileATTC() / _compileLUPcls())
 {
     int trace          = FALSE;   //TRUE = debug
     int best_nATTmatch = 0;  // best attribute value match
@@ -694,6 +825,21 @@ static _LUP      *_lookUpLUP(_LUP *LUPlist, S57_geo *geoData)
         }
     }
 
+    if (NULL == LUP->cls) {
+        PRINTF("ERROR: LUP class not compiled [%s]\n", LUP->OBCL);
+        g_assert(0);
+        return LUP;
+    }
+
+    // fetch (and decode) each attribute of this class once for all LUP
+    guint    natt = LUP->cls->natt;
+    GString *attv   [natt + 1];   // +1 - no zero size VLA
+    int      attvInt[natt + 1];
+    for (guint i=0; i<natt; ++i) {
+        attv[i]    = S57_getAttValQ(geoData, LUP->cls->attQ[i]);
+        attvInt[i] = (NULL == attv[i]) ? 0 : atoi(attv[i]->str);
+    }
+
     // Get next LUP --the first one is alway empty.
     LUPlist = LUPlist->OBCLnext;
 
@@ -704,99 +850,67 @@ static _LUP      *_lookUpLUP(_LUP *LUPlist, S57_geo *geoData)
     while (LUPlist) {
         int      skipLUP   = 0;   //
         int      nATTmatch = 0;   // nbr of att value match for this LUP
-        char    *attlv     = (NULL == LUPlist->ATTC) ? NULL : LUPlist->ATTC->str; // ATTL+ATTV
 
-        if (NULL == attlv) {
+        if (NULL == LUPlist->attc) {
             LUPlist = LUPlist->OBCLnext;
             continue;
         }
 
         if (trace)
-            _dumpATT(attlv);
-
-        while (*attlv != '\0' && !skipLUP) {
-            char     attl[7] = {'\0'}; // attribute name
-            GString *attv    = NULL;   // attribute value
+            _dumpATT(LUPlist->ATTC->str);
 
-            // scan object attribute name (ie propertie name in OGR)
-            // for a name match
-            strncat(attl, attlv, 6);
-            attv = S57_getAttVal(geoData, attl);
-            if (NULL != attv) {
-                //PRINTF("attv: %s\n", attv->str);
+        for (guint i=0; i<LUPlist->attc->len && !skipLUP; ++i) {
+            _LUPatt *att = &g_array_index(LUPlist->attc, _LUPatt, i);
+            GString *val = attv[att->idx];   // attribute value
 
-                // Check for a attribute value match.
-                // All attribute value must match.
-                // So if attribute name doesn't matche try next LUP.
-
-                // OK here we have an attribute name match
-                // checking now for attribute value match
-
-                // special case [S52-A-2:8.3.3.4(i)]
-                // ie. use any attribute value (except value unknown)
-                if ( (attlv[6] == ' ') && (0!=g_strcmp0(attv->str, EMPTY_NUMBER_MARKER)) ) {
-                    ++nATTmatch;
+            if (NULL == val) {
+                skipLUP   = 1;
+                nATTmatch = 0;
+                //PRINTF("SKIP\n");
+                continue;
+            }
 
-                } else {
-                    // special case [S52-A-2:8.3.3.4(ii)]
-                    // ie. match if value is unknown
-                    if ( (attlv[6] == '?') && (0==g_strcmp0(attv->str, EMPTY_NUMBER_MARKER)) ) {
-                    //if ( (attlv[6] == '?') ) {
-                        ++nATTmatch;
-                        // give DRVAL1 = 0.0
-                        // but should be unknown
-                        // see CA49995A FIDN:327146 FIDS:9
-                        // FIX: export PRESERVE_EMPTY_NUMBERS:ON
-
-
-                    // value check
-                    } else {
-                        // no attribut value in LUP (ex ORIENT in TSSLPT)
-                        if (attlv[6] == '\0')
-                            ++nATTmatch;
-                        else {
-                            char *tmpVal = strstr(attv->str, attlv+6);
-                            // must match *exacly*
-                            // so '4,3,4' match '4,3,4,7' but not 3,4,3 (4,3 match)
-                            // the trick is to use the lenght of of the value of
-                            // the PLib *not* from S57
-                            //char *tmpVal = strncmp(attv->str, attlv+6, strlen(attlv)-6);
-
-                            // FIX: record the max lenght of att val str of a match
-                            if (NULL != tmpVal) {
-                                //int len = strlen(tmpVal);
-                                //if (len < attv->len
-                                //if (len >= best_attValLen) {
-                                //    best_attValLen = len;
-                                //    ++nATTmatch;
-                                //}
-                                int valS57 = atoi(attv->str);
-                                int valLUP = atoi(attlv+6);
-                                if (valS57 == valLUP)
-                                    ++nATTmatch;
-                            }
-                            // skip this lookup
-                            else
-                                skipLUP = 1;
-                        }
-                    }
-                }
+            // OK here we have an attribute name match
+            // checking now for attribute value match.
+            // All attribute value must match.
 
-                // get next attribute name/value for this LUP
-                while (*attlv != '\0')
-                    attlv++;  // find end of attribue name/value pair
+            // special case [S52-A-2:8.3.3.4(i)]
+            // ie. use any attribute value (except value unknown)
+            if ( (' ' == att->mode) && (0!=g_strcmp0(val->str, EMPTY_NUMBER_MARKER)) ) {
+                ++nATTmatch;
+                continue;
+            }
 
-                attlv++;  // skip end of field --witch is now a '\0'
+            // special case [S52-A-2:8.3.3.4(ii)]
+            // ie. match if value is unknown
+            // give DRVAL1 = 0.0
+            // but should be unknown
+            // see CA49995A FIDN:327146 FIDS:9
+            // FIX: export PRESERVE_EMPTY_NUMBERS:ON
+            if ( ('?' == att->mode) && (0==g_strcmp0(val->str, EMPTY_NUMBER_MARKER)) ) {
+                ++nATTmatch;
+                continue;
+            }
 
+            // no attribut value in LUP (ex ORIENT in TSSLPT)
+            if ('\0' == att->mode) {
+                ++nATTmatch;
+                continue;
+            }
 
+            // value check
+            // must match *exacly*
+            // so '4,3,4' match '4,3,4,7' but not 3,4,3 (4,3 match)
+            // the trick is to use the lenght of of the value of
+            // the PLib *not* from S57
+            if (NULL != strstr(val->str, att->str)) {
+                if (attvInt[att->idx] == att->val)
+                    ++nATTmatch;
             } else {
-                skipLUP   = 1;
-                nATTmatch = 0;
-                //nATTmatch = 1;
-                //PRINTF("SKIP\n");
+                // skip this lookup
+                skipLUP = 1;
             }
-
-        } // while
+        }
 
         // BUG: the first match found is returned!
         //if (nATTmatch > best_nATTmatch) {
@@ -922,7 +1036,7 @@ static _cmdWL    *_initCmdA(_S52_obj *obj, int alt)
 // return the CS command in cmd list, else NULL
 // start to fill the command array upto the first CS
 {
-    _cmdWL *cmd = obj->cmdLorig[alt];
+    _cmdWL *cmd = (NULL == obj->cmdLorig[alt]) ? NULL : obj->cmdLorig[alt]->cmdL;
 
     g_array_set_size(obj->cmdAfinal[alt], 0);
 
@@ -952,6 +1066,53 @@ static int        _freeCmdList(_cmdWL *top)
    return TRUE;
 }
 
+static _cmdLshr  *_cmdLget(GString *inst, int own)
+// return the shared parsed list of this instruction, parse it if new
+// own: TRUE - 'inst' is handed over (free if allready there), FALSE - copied
+{
+    GMUTEXLOCK(&_cmdLmutex);
+
+    ++_cmdLnReq;
+
+    _cmdLshr *shr = (_cmdLshr*) g_hash_table_lookup(_cmdLtbl, inst->str);
+    if (NULL != shr) {
+        ++shr->ref;
+        ++_cmdLnHit;
+        if (TRUE == own)
+            g_string_free(inst, TRUE);
+    } else {
+        shr       = g_new0(_cmdLshr, 1);
+        shr->inst = (TRUE == own) ? inst : g_string_new(inst->str);
+        shr->cmdL = _parseINST(shr->inst);
+        shr->ref  = 1;
+        g_hash_table_insert(_cmdLtbl, shr->inst->str, shr);
+    }
+
+    GMUTEXUNLOCK(&_cmdLmutex);
+
+    return shr;
+}
+
+static int        _cmdLput(_cmdLshr *shr)
+// release this obj hold on a shared list, free it if last
+{
+    if (NULL == shr)
+        return FALSE;
+
+    GMUTEXLOCK(&_cmdLmutex);
+
+    if (0 == --shr->ref) {
+        g_hash_table_remove(_cmdLtbl, shr->inst->str);
+        _freeCmdList(shr->cmdL);
+        g_string_free(shr->inst, TRUE);
+        g_free(shr);
+    }
+
+    GMUTEXUNLOCK(&_cmdLmutex);
+
+    return TRUE;
+}
+
 static gint       _freeTXT(_Text *text)
 {
     if (NULL != text->frmtd) {
@@ -992,13 +1153,8 @@ static int        _resolveSMB(_S52_obj *obj, int alt)
     //    PRINTF("%s\n",FIDNstr->str);
     //}
 
-    // clear old CS instruction
-    if (NULL != obj->CSinst[alt])
-        g_string_free(obj->CSinst[alt], TRUE);
-    obj->CSinst[alt] = NULL;
-
-    // clear old CS command list
-    _freeCmdList(obj->CScmdL[alt]);
+    // release old CS instruction / command list
+    _cmdLput(obj->CScmdL[alt]);
     obj->CScmdL[alt] = NULL;
 
     // search list for CS, start building command array
@@ -1011,6 +1167,7 @@ static int        _resolveSMB(_S52_obj *obj, int alt)
 
     // reset priority override
     obj->prioOveride = FALSE;
+    obj->toggleGen   = 0;     // DISC can change
     obj->DPRI = obj->LUP->DPRI;
     obj->RPRI = obj->LUP->RPRI;
     obj->DISC = obj->LUP->DISC;
@@ -1019,11 +1176,15 @@ static int        _resolveSMB(_S52_obj *obj, int alt)
     // expand CS
     S52_CS_cb CScb = cmd->cmd.CS->CScb;
     if (NULL != CScb) {
-        obj->CSinst[alt] = CScb(obj->geoData);
-        if (NULL != obj->CSinst[alt]) {
-            _cmdWL *tmp   = NULL;
-            obj->CScmdL[alt] = _parseINST(obj->CSinst[alt]);
-            tmp = obj->CScmdL[alt];
+        // record Mariner's Param this CS depend on
+        S52_MP_depBeg();
+        GString *CSinst = CScb(obj->geoData);
+        obj->CSdep     |= S52_MP_depEnd();
+        if (NULL != CSinst) {
+            // many obj resolve to the same CS output (SOUNDG, DEPARE, buoy, ..)
+            // so the parsed list is shared
+            obj->CScmdL[alt] = _cmdLget(CSinst, TRUE);
+            _cmdWL *tmp      = obj->CScmdL[alt]->cmdL;
             while (NULL != tmp) {
                 // change object Display Priority, if any, at this point
                 if (S52_CMD_OVR_PR == tmp->cmdWord) {
@@ -1083,6 +1244,8 @@ int         S52_PL_resloveSMB(_S52_obj *obj)
     S52_PL_resetParseText(obj);
 
     // Then: pull new command word from CS (wich could have diffent text)
+    // the CS can take a new branch - record only the Mariner's Param read by this resolve
+    obj->CSdep = 0;
     _resolveSMB(obj, 0);
     _resolveSMB(obj, 1);
 
@@ -1559,6 +1722,7 @@ static int        _parseLUPT(_PL *fp)
                     //LUP->ATTC = g_string_new_len(_pBuf+9, len-9);
                     LUP->ATTC = g_string_new(_pBuf+9);
                     _chopAtEOL(LUP->ATTC->str, '\0');   // rechop the line (ie "xyz\0zxy\0yzx\0\0")
+                    _compileATTC(LUP);
                 }
             }
         }
@@ -1873,6 +2037,8 @@ static int        _initPLtables()
 
     _table[SMB_COND]     = g_tree_new(_cmpCOND);
 
+    _cmdLtbl             = g_hash_table_new(g_str_hash, g_str_equal);
+
     return TRUE;
 }
 
@@ -1894,6 +2060,17 @@ static int        _loadPL(_PL *fp)
         //PRINTF("read:%d %s\n", nRead,_pBuf);
     }
 
+    // (re)compile the attribute list of each LUP class
+    // (a PLib can be loaded on top of an other - chain may have changed)
+    g_tree_foreach(_selLUP(_LUP_SIMPL), _compileLUPcls, NULL);
+    g_tree_foreach(_selLUP(_LUP_PAPER), _compileLUPcls, NULL);
+    g_tree_foreach(_selLUP(_LUP_LINES), _compileLUPcls, NULL);
+    g_tree_foreach(_selLUP(_LUP_PLAIN), _compileLUPcls, NULL);
+    g_tree_foreach(_selLUP(_LUP_SYMBO), _compileLUPcls, NULL);
+
+    // LUP (DISC, supp) may have changed - recompute toggle state of obj
+    g_atomic_int_inc(&_toggleGen);
+
 #ifdef S52_DEBUG
     /////////////////////////////////
     // statistic
@@ -2279,6 +2456,8 @@ int         S52_PL_init()
 
     _loadCondSymb();
 
+    S52_PL_resetToggle();
+
     _objList = g_ptr_array_new();
 
     return TRUE;
@@ -2325,6 +2504,43 @@ int         S52_PL_load(const char *PLib)
     return TRUE;
 }
 
+int         S52_PL_statCmdL(void)
+// report sharing of parsed instruction list (LUP INST + CS output)
+{
+    if (NULL == _cmdLtbl)
+        return FALSE;
+
+    GMUTEXLOCK(&_cmdLmutex);
+    guint nReq = _cmdLnReq;
+    guint nHit = _cmdLnHit;
+    guint nLst = g_hash_table_size(_cmdLtbl);
+    GMUTEXUNLOCK(&_cmdLmutex);
+
+    PRINTF("instruction list: %u request, %u shared (%.1f%%), %u unique list live\n",
+           nReq, nHit, (0==nReq) ? 0.0 : (100.0*nHit)/nReq, nLst);
+
+    return TRUE;
+}
+
+int         S52_PL_statLUP(void)
+// report the look-up rate since the last call (S52_DEBUG)
+{
+#ifdef S52_DEBUG
+    if (0 == _LUPn)
+        return FALSE;
+
+    PRINTF("look-up: %u LUP in %.3f msec, %.0f look-up/sec\n",
+           _LUPn, _LUPsec * 1000.0, (0.0==_LUPsec) ? 0.0 : _LUPn/_LUPsec);
+
+    _LUPn   = 0;
+    _LUPsec = 0.0;
+
+    return TRUE;
+#else
+    return FALSE;
+#endif
+}
+
 int         S52_PL_done()
 {
     _flushColors();
@@ -2356,6 +2572,29 @@ int         S52_PL_done()
             _table[i] = NULL;
     }
 
+    // flush shared instruction list (obj not deleted by the caller)
+#ifdef S52_DEBUG
+    S52_PL_statCmdL();
+
+    if (NULL != _LUPtimer)
+        g_timer_destroy(_LUPtimer);
+    _LUPtimer = NULL;
+#endif
+    {
+        GHashTableIter iter;
+        gpointer       key, value;
+
+        g_hash_table_iter_init(&iter, _cmdLtbl);
+        while (g_hash_table_iter_next(&iter, &key, &value)) {
+            _cmdLshr *shr = (_cmdLshr*) value;
+            _freeCmdList(shr->cmdL);
+            g_string_free(shr->inst, TRUE);
+            g_free(shr);
+        }
+        g_hash_table_destroy(_cmdLtbl);
+        _cmdLtbl = NULL;
+    }
+
     // flush plibID
     while (NULL != _plibID) {
         _LBID *tmpID = _plibID->next;
@@ -2470,7 +2709,19 @@ static int        _linkLUP(_S52_obj *obj, int alt)
     // get list of LUP for S57 object of this class
     LUPlist = (_LUP*)g_tree_lookup(tbl, (gpointer*)objName);
     if (NULL != LUPlist) {
+#ifdef S52_DEBUG
+        // look-up rate (see S52_PL_statLUP())
+        if (NULL == _LUPtimer)
+            _LUPtimer = g_timer_new();
+        g_timer_start(_LUPtimer);
+#endif
+
         obj->LUP = _lookUpLUP(LUPlist, obj->geoData);
+
+#ifdef S52_DEBUG
+        _LUPsec += g_timer_elapsed(_LUPtimer, NULL);
+        ++_LUPn;
+#endif
     } else {
         PRINTF("WARNING: defaulting to QUESMRK1, no LUP found for object name: %s\n", objName);
 
@@ -2484,7 +2735,7 @@ static int        _linkLUP(_S52_obj *obj, int alt)
     }
 
     // get tokenized instruction list
-    obj->cmdLorig[alt] = _parseINST(obj->LUP->INST);
+    obj->cmdLorig[alt] = _cmdLget(obj->LUP->INST, FALSE);
 
 
     // also hold parameter for CS command found in CSinst
@@ -2523,7 +2774,7 @@ S52_obj    *S52_PL_newObj(S57_geo *geoData)
     return_if_null(geoData);
 
     S52_obj *obj = NULL;
-    guint    idx = S57_getGeoS57ID(geoData);
+    guint    idx = S57_getS57IDslot(S57_getGeoS57ID(geoData));
     if (idx<_objList->len && (NULL != (obj = g_ptr_array_index(_objList, idx)))) {
         S52_PL_delObj(obj, FALSE);
     } else {
@@ -2541,6 +2792,9 @@ S52_obj    *S52_PL_newObj(S57_geo *geoData)
     obj->textParsed[0] = FALSE;
     obj->textParsed[1] = FALSE;
 
+    obj->CSdep         = 0;
+    obj->toggleGen     = 0;
+
     // NOTE: this is a general holder for orient/speed depending on
     // the object type. So it could be for current, ship, AIS, ...
     obj->orient        = INFINITY;
@@ -2601,7 +2855,7 @@ S57_geo    *S52_PL_delObj(_S52_obj *obj, gboolean updateObjL)
     /*
     //---------------------------------------------
     // debug
-    _cmdWL *top = obj->cmdLorig[0];
+    _cmdWL *top = obj->cmdLorig[0]->cmdL;
     unsigned int ncmd = 0;
     // count normal command
     while (NULL != top) {
@@ -2609,7 +2863,7 @@ S57_geo    *S52_PL_delObj(_S52_obj *obj, gboolean updateObjL)
         top = top->next;
     }
     // count CS command
-    top = obj->CScmdL[0];
+    top = obj->CScmdL[0]->cmdL;
     while (NULL != top) {
         ++ncmd;
         top = top->next;
@@ -2627,22 +2881,17 @@ S57_geo    *S52_PL_delObj(_S52_obj *obj, gboolean updateObjL)
     _freeAllTXT(obj->cmdAfinal[0]);
     _freeAllTXT(obj->cmdAfinal[1]);
 
-    _freeCmdList(obj->cmdLorig[0]);
-    _freeCmdList(obj->cmdLorig[1]);
+    _cmdLput(obj->cmdLorig[0]);
+    _cmdLput(obj->cmdLorig[1]);
     obj->cmdLorig[0] = NULL;
     obj->cmdLorig[1] = NULL;
 
     // clear conditional stuff
-    _freeCmdList(obj->CScmdL[0]);
-    _freeCmdList(obj->CScmdL[1]);
+    _cmdLput(obj->CScmdL[0]);
+    _cmdLput(obj->CScmdL[1]);
     obj->CScmdL[0] = NULL;
     obj->CScmdL[1] = NULL;
 
-    if (obj->CSinst[0]) g_string_free(obj->CSinst[0], TRUE);
-    if (obj->CSinst[1]) g_string_free(obj->CSinst[1], TRUE);
-    obj->CSinst[0] = NULL;
-    obj->CSinst[1] = NULL;
-
     if (obj->cmdAfinal[0]) g_array_free(obj->cmdAfinal[0], TRUE);
     if (obj->cmdAfinal[1]) g_array_free(obj->cmdAfinal[1], TRUE);
     obj->cmdAfinal[0] = NULL;
@@ -2654,7 +2903,8 @@ S57_geo    *S52_PL_delObj(_S52_obj *obj, gboolean updateObjL)
     // WARNING: note that Aux Info is not touched - still in 'obj'
     //
 
-    S52_obj *objFree = (S52_obj *)g_ptr_array_index(_objList, S57_getGeoS57ID(obj->geoData));
+    guint    idx     = S57_getS57IDslot(S57_getGeoS57ID(obj->geoData));
+    S52_obj *objFree = (S52_obj *)g_ptr_array_index(_objList, idx);
     if (NULL == objFree) {
         PRINTF("DEBUG: should not be NULL (%u)\n", S57_getGeoS57ID(obj->geoData));
         g_assert(0);
@@ -2662,8 +2912,8 @@ S57_geo    *S52_PL_delObj(_S52_obj *obj, gboolean updateObjL)
 
     S57_geo *geo = obj->geoData;
     if (TRUE == updateObjL) {
-        // nullify obj in array at index
-        g_ptr_array_index(_objList, S57_getGeoS57ID(geo)) = NULL;
+        // nullify obj in array at index - the slot will be reused (see S57_doneData())
+        g_ptr_array_index(_objList, idx) = NULL;
     }
 
     return geo;
@@ -2711,6 +2961,13 @@ S57_Obj_t   S52_PL_getFTYP(_S52_obj *obj)
         return obj->LUP->FTYP;
 }
 
+guint64     S52_PL_getCSdep(_S52_obj *obj)
+{
+    return_if_null(obj);
+
+    return obj->CSdep;
+}
+
 S52_disPrio S52_PL_getDPRI(_S52_obj *obj)
 {
     return_if_null(obj);
@@ -2895,7 +3152,7 @@ int         S52_PL_cmpCmdParam(_S52_obj *obj, const char *name)
 
     /* debug: dump command string
     if (NULL == name) {
-        PRINTF("DEBUG: %s\n", obj->CSinst[0]->str);
+        PRINTF("DEBUG: %s\n", obj->CScmdL[0]->inst->str);
         return FALSE;
     }
     */
@@ -3193,30 +3450,6 @@ int         S52_PL_getAPTilePos(_S52_obj *obj, double *bbx, double *bby, double
 
     return TRUE;
 }
-
-int         S52_PL_setAPtexID(_S52_obj *obj, guint mask_texID)
-{
-    return_if_null(obj);
-
-    _cmdWL *cmd = _getCrntCmd(obj);
-    if ((NULL==cmd) || (NULL==cmd->cmd.def))
-        return FALSE;
-
-    cmd->cmd.def->mask_texID = mask_texID;
-
-    return TRUE;
-}
-
-guint       S52_PL_getAPtexID(_S52_obj *obj)
-{
-    return_if_null(obj);
-
-    _cmdWL *cmd = _getCrntCmd(obj);
-    if ((NULL==cmd) || (NULL==cmd->cmd.def))
-        return FALSE;
-
-    return cmd->cmd.def->mask_texID;
-}
 #endif  // S52_USE_GL2 | S52_USE_GLES2
 
 gint        S52_PL_traverse(S52_SMBtblName tableNm, GTraverseFunc callBack)
@@ -3942,6 +4175,9 @@ S52_objSupp S52_PL_toggleObjClass(const char *className)
             supp = _toggleLUPlist(LUPlist);
     }
 
+    // LUP supp changed - recompute toggle state of obj
+    g_atomic_int_inc(&_toggleGen);
+
     return supp;
 }
 
@@ -3963,26 +4199,11 @@ S52_objSupp S52_PL_getObjClassState(const char *className)
     return S52_SUPP_ERR;
 }
 
-S52_objSupp S52_PL_getObjToggleState(_S52_obj *obj)
+static
+S52_objSupp       _getToggleState(int lupDisp, S52_objSupp supp)
+// toggle state of an obj of display category 'lupDisp' and LUP suppression 'supp'
+// for the current S52_MAR_DISP_CATEGORY / S52_MAR_DISP_LAYER_LAST (see _toggleTbl)
 {
-    if (NULL == obj)
-        return S52_SUPP_ERR;
-
-    // debug
-    //if (0 == g_strcmp0(S52_PL_getOBCL(obj), "M_QUAL")) {
-    //    PRINTF("M_QUAL found\n");
-    //}
-    //if (0 == g_strcmp0("M_COVR", S52_PL_getOBCL(obj))) {
-    //    PRINTF("DEBUG: M_COVR found\n");
-    //}
-
-
-    // META's can't be displayed (ex: C_AGGR)
-    if (NULL == obj->LUP)
-        return S52_SUPP_ON;
-
-    int lupDisp = S52_PL_getDISC(obj);
-
     // Mariners Objects
     if (MARINERS_STANDARD==lupDisp || MARINERS_OTHER==lupDisp) {
         unsigned int mask = (unsigned int)S52_MP_get(S52_MAR_DISP_LAYER_LAST);
@@ -3994,7 +4215,7 @@ S52_objSupp S52_PL_getObjToggleState(_S52_obj *obj)
 
         // MAR Selected choice (override STD & OTHER)
         if (S52_MAR_DISP_LAYER_LAST_SELECT  & mask) {
-            if (S52_SUPP_ON == obj->LUP->supp)
+            if (S52_SUPP_ON == supp)
                 return S52_SUPP_ON;
             return S52_SUPP_OFF;
         }
@@ -4042,7 +4263,7 @@ S52_objSupp S52_PL_getObjToggleState(_S52_obj *obj)
         // previous mariner choice is preserve
         //if (FALSE != (S52_MAR_DISP_CATEGORY_SELECT & mask))
         if (0 < (S52_MAR_DISP_CATEGORY_SELECT & mask))
-            return obj->LUP->supp;
+            return supp;
 
         // case of BASE only - all other cat. are OFF
         //if (S52_MAR_DISP_CATEGORY_BASE   & (int)S52_MP_get(S52_MAR_DISP_CATEGORY)) {
@@ -4084,6 +4305,57 @@ S52_objSupp S52_PL_getObjToggleState(_S52_obj *obj)
     return S52_SUPP_ERR;
 }
 
+int         S52_PL_resetToggle(void)
+// rebuild the toggle state table - call when S52_MAR_DISP_CATEGORY / S52_MAR_DISP_LAYER_LAST change
+// (also invalidate the toggle state cached in each obj)
+{
+    for (int disc=0; disc<256; ++disc) {
+        for (int supp=S52_SUPP_OFF; supp<=S52_SUPP_ERR; ++supp) {
+            _toggleTbl[disc][supp] = _getToggleState(disc, (S52_objSupp)supp);
+        }
+    }
+
+    g_atomic_int_inc(&_toggleGen);
+
+    return TRUE;
+}
+
+S52_objSupp S52_PL_getObjToggleState(_S52_obj *obj)
+// Note: called from the cull task - write only the toggle state cached in obj (obj of this cell)
+{
+    if (NULL == obj)
+        return S52_SUPP_ERR;
+
+    // debug
+    //if (0 == g_strcmp0(S52_PL_getOBCL(obj), "M_QUAL")) {
+    //    PRINTF("M_QUAL found\n");
+    //}
+    //if (0 == g_strcmp0("M_COVR", S52_PL_getOBCL(obj))) {
+    //    PRINTF("DEBUG: M_COVR found\n");
+    //}
+
+    // nothing changed since the last frame
+    if (obj->toggleGen == (guint)_toggleGen)
+        return obj->toggle;
+
+    // META's can't be displayed (ex: C_AGGR)
+    if (NULL == obj->LUP) {
+        obj->toggle = S52_SUPP_ON;
+    } else {
+        guchar      disc = (guchar) S52_PL_getDISC(obj);
+        S52_objSupp supp = obj->LUP->supp;
+
+        if (S52_SUPP_ERR < supp)
+            obj->toggle = _getToggleState(disc, supp);  // failsafe
+        else
+            obj->toggle = _toggleTbl[disc][supp];
+    }
+
+    obj->toggleGen = (guint)_toggleGen;
+
+    return obj->toggle;
+}
+
 int         S52_PL_getOffset(_S52_obj *obj, double *offset_x, double *offset_y)
 {
     return_if_null(obj);
@@ -4217,50 +4489,6 @@ long        S52_PL_getTimeSec(_S52_obj *obj)
     return obj->time.tv_sec;
 }
 
-#ifdef S52_USE_FREETYPE_GL
-guint       S52_PL_getFreetypeGL_VBO(_S52_obj *obj, guint *len)
-{
-    return_if_null(obj);
-
-    _cmdWL *cmd = _getCrntCmd(obj);
-    if (NULL == cmd)
-        return FALSE;
-
-    // Note: S52_CMD_SYM_PT pass here - speed text on leg
-    if ((S52_CMD_TXT_TX!=cmd->cmdWord) && (S52_CMD_TXT_TE!=cmd->cmdWord) && (S52_CMD_SYM_PT!=cmd->cmdWord)) {
-        //PRINTF("DEBUG: not a text command [cmdWord:%i]\n", cmd->cmdWord);
-        return FALSE;
-    }
-
-    *len = cmd->len;
-
-    return cmd->vboID;
-}
-
-int         S52_PL_setFreetypeGL_VBO(_S52_obj *obj, guint vboID, guint len)
-{
-    return_if_null(obj);
-
-    _cmdWL *cmd = _getCrntCmd(obj);
-    if (NULL == cmd)
-        return FALSE;
-
-    // parano
-    // Note: S52_CMD_SYM_PT pass here - speed text on leg
-    if ((S52_CMD_TXT_TX!=cmd->cmdWord) && (S52_CMD_TXT_TE!=cmd->cmdWord) && (S52_CMD_SYM_PT!=cmd->cmdWord)) {
-        PRINTF("DEBUG: logic bug, not a text command [cmdWord:%i]\n", cmd->cmdWord);
-        g_assert(0);
-
-        return FALSE;
-    }
-
-    cmd->vboID = vboID;
-    cmd->len   = len;
-
-    return TRUE;
-}
-#endif
-
 #if 0
 int         S52_PL_setLOD(_S52_obj *obj, char LOD)
 {
@@ -4304,20 +4532,24 @@ S52_obj    *S52_PL_isObjValid(unsigned int objH)
         return NULL;
     }
 
-    S52_obj *obj = (S52_obj *)g_ptr_array_index(_objList, objH);
+    guint idx = S57_getS57IDslot(objH);
+    if (idx >= _objList->len) {
+        PRINTF("WARNING: objH %u out of range\n", objH);
+        return NULL;
+    }
+
+    S52_obj *obj = (S52_obj *)g_ptr_array_index(_objList, idx);
     if (NULL == obj) {
         // FIXME: why is this still happenning! AIS!!
-        PRINTF("WARNING: objH %i is NULL obj\n", objH);
+        PRINTF("WARNING: objH %u is NULL obj\n", objH);
         //g_assert(0);
 
         return NULL;
     }
 
+    // slot reused - objH is a handle of a deleted obj (generation mismatch)
     if (objH != S57_getGeoS57ID(obj->geoData)) {
-        PRINTF("WARNING: idx obj mismatch obj geoID \n");
-
-        g_assert(0);
-
+        PRINTF("WARNING: objH %u is stale (slot now hold %u)\n", objH, S57_getGeoS57ID(obj->geoData));
         return NULL;
     }
 
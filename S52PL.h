@@ -173,6 +173,10 @@ int            S52_PL_init();
 int            S52_PL_load(const char *PLib);
 // free presentation library
 int            S52_PL_done();
+// debug - report the sharing of parsed instruction list (LUP INST + CS output)
+int            S52_PL_statCmdL(void);
+// debug - report the look-up rate (LUP linked since the last call), need S52_DEBUG
+int            S52_PL_statLUP(void);
 
 // get RGB from color name, for the currently selected color table
 S52_Color     *S52_PL_getColor(const char *colorName);
@@ -256,9 +260,6 @@ int            S52_PL_getAPTileDim(S52_obj *obj, double *tw,  double *th,  doubl
 #if (defined(S52_USE_GL2) || defined(S52_USE_GLES2))
 // get Area Pattern Position
 int            S52_PL_getAPTilePos(S52_obj *obj, double *bbx, double *bby, double *pivot_x, double *pivot_y);
-// store texture ID of patterns in GLES2
-int            S52_PL_setAPtexID(S52_obj *obj, guint mask_texID);
-guint          S52_PL_getAPtexID(S52_obj *obj);
 #endif
 
 // traverse a symbology table calling 'callback' for each entree
@@ -287,11 +288,15 @@ const char    *S52_PL_hasCS(S52_obj *obj);
 
 // toggle display suppression of this class of object
 S52_objSupp    S52_PL_toggleObjClass(const char *className);
+// rebuild the toggle state table (S52_MAR_DISP_CATEGORY / S52_MAR_DISP_LAYER_LAST changed)
+int            S52_PL_resetToggle(void);
 // get display state for this type of object
 S52_objSupp    S52_PL_getObjToggleState(S52_obj *obj);
 S52_objSupp    S52_PL_getObjClassState(const char *className);
 
 int            S52_PL_resloveSMB(S52_obj *obj);
+// Mariner's Param read by the CS of this obj - bit mask of S52_MP_BIT()
+guint64        S52_PL_getCSdep(S52_obj *obj);
 
 int            S52_PL_getOffset(S52_obj *obj, double *offset_x, double *offset_y);
 
@@ -317,11 +322,6 @@ int            S52_PL_setTimeNow(S52_obj *obj);
 long           S52_PL_getTimeSec(S52_obj *obj);
 
 
-#ifdef S52_USE_FREETYPE_GL
-guint          S52_PL_getFreetypeGL_VBO(S52_obj *obj, guint *len);
-int            S52_PL_setFreetypeGL_VBO(S52_obj *obj, guint vboID, guint len);
-#endif
-
 //int            S52_PL_setLOD(S52_obj *obj, char LOD);
 //char           S52_PL_getLOD(S52_obj *obj);
 
@@ -103,6 +103,12 @@ static const char _version[] = S52_VERSION
 #ifdef  S52_USE_GLES2
       ",S52_USE_GLES2"
 #endif
+#ifdef  S52_USE_GL3
+      ",S52_USE_GL3"
+#endif
+#ifdef  S52_USE_GLES3
+      ",S52_USE_GLES3"
+#endif
 #ifdef  S52_USE_ANDROID
       ",S52_USE_ANDROID"
 #endif
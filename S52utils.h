@@ -64,6 +64,7 @@ if (NULL==ptr) {                             \
 #define CFG_CHART    "CHART"
 #define CFG_WORLD    "WORLD"
 #define CFG_TTF      "TTF"
+#define CFG_TILE     "TILE"
 
 #define MAXL 1024    // MAX lenght of buffer _including_ '\0'
 typedef char valueBuf[MAXL];
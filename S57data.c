@@ -24,7 +24,7 @@
 #include "S57data.h"    // S57_geo
 #include "S52utils.h"   // PRINTF()
 
-#include <math.h>       // INFINITY, nearbyint()
+#include <math.h>       // INFINITY, nearbyint(), sqrt()
 
 #ifdef S52_USE_PROJ
 static projPJ      _pjsrc   = NULL;   // projection source
@@ -45,8 +45,21 @@ static const char *_argssrc = "+proj=latlong +ellps=WGS84 +datum=WGS84";
 
 #define UNKNOWN  (1.0/0.0)   //HUGE_VAL   // INFINITY/NAN
 
-// debug: current object's internal ID
-static unsigned int _S57ID = 1;  // start at 1, the number of object loaded
+// S57ID: slot map - slot index (low bits) + generation of the slot (high bits)
+// The slot of a geo is reused once the geo is freed. The generation change so that the
+// S57ID (S52ObjectHandle) of a deleted obj doesn't alias the obj now in that slot.
+// Free slot are reused FIFO and only once S57ID_FREE_MIN slot are free, so a slot come back
+// after at least S57ID_FREE_MIN other delete - a churning obj (AIS) doesn't get its slot back at once.
+// Note: generation wrap after 1024 reuse of a slot, ie after at least 1024 * S57ID_FREE_MIN (4M) delete
+// Note: not thread safe - geo are created / freed by the main thread (load, mariner obj)
+#define S57ID_SLOT_BITS 22     // 4M slot
+#define S57ID_SLOT_MASK ((1u << S57ID_SLOT_BITS) - 1)
+#define S57ID_GEN_MASK  ((1u << (32 - S57ID_SLOT_BITS)) - 1)
+#define S57ID_FREE_MIN  4096
+static GArray *_S57IDgen  = NULL;  // guint16 - generation of each slot (slot 0 not used, 0 is not a valid S57ID)
+static GArray *_S57IDfree = NULL;  // guint   - free slot, FIFO from _S57IDhead
+static guint   _S57IDhead = 0;     // next free slot to reuse in _S57IDfree
+static guint   _S57IDlive = 0;     // statistic - nbr of slot in use
 
 typedef struct _pt3 { double x,y,z; } pt3;
 typedef struct _pt2 { double x,y;   } pt2;
@@ -73,23 +86,54 @@ typedef struct _S57_prim {
     GArray *list;      // list of _prim in 'vertex'
     GArray *vertex;    // XYZ geographic coordinate (bouble or float for GLES2 since some go right in the GPU - ie line)
     guint   DList;     // display list of the above
+    double  orig[2];   // 'vertex' are relative to this origin (PRJ) - float precision in GLES2
 } _S57_prim;
 
+// level of detail - LINES / AREAS simplified at load
+typedef struct _lod {
+    guint       *ringxyznbr;  // number coords per ring (LINES: 1 ring)
+    geocoord   **ringxyz;     // coords of rings
+    guint        saved;       // number of coords saved at this level
+    S57_prim    *prim;        // tessalated AREAS of this level
+} _lod;
+
+// tolerance of each level (meter) - grid size used to snap coords
+static const double _lodTol[S57_LOD_NBR] = {0.0, 8.0, 32.0, 128.0};
+
+// typed value of attribute used by CS (S57_AttD / S57_AttL) - decoded by S57_setAtt()
+// alloc only if the geo has one of these attribute
+typedef struct _attTyped {
+    guint        hasD;                          // bit (1<<S57_AttD) set if valD[] decoded
+    double       valD[S57_ATT_D_NBR];
+    guchar       nL  [S57_ATT_L_NBR];           // number of value in valL[], 0 - abscent
+    char         valL[S57_ATT_L_NBR][S57_ATT_LISTSIZE];
+} _attTyped;
+
+static const char *_attDname[S57_ATT_D_NBR] = {"DRVAL1", "DRVAL2", "VALDCO", "VALSOU", "SECTR1", "SECTR2", "VALNMR"};
+static const char *_attLname[S57_ATT_L_NBR] = {"CATLIT", "COLOUR"};
+static GQuark      _attDq   [S57_ATT_D_NBR];
+static GQuark      _attLq   [S57_ATT_L_NBR];
+
 // S57 object geo data
 #define S57_ATT_NM_LN    6   // S57 Class Attribute Name lenght
 #define S57_GEO_NM_LN   13   // GDAL/OGR primitive name: "ConnectedNode"
 typedef struct _S57_geo {
-    guint        S57ID;          // record ID / S52ObjectHandle use as index in S52_obj GPtrArray
+    // --- hot: read by the cull on every frame ---
+    // keep at the start - 56 bytes, one cache line if the block is aligned (not guaranteed by malloc)
+    guint        S57ID;          // record ID / S52ObjectHandle - slot (index in S52_obj GPtrArray) + generation
+    S57_Obj_t    obj_t;       // PL & S57 - P/L/A
+    _rect        rect;        // lat/lon extent of this S75 object
+    double       scamin;
+    gboolean     highlight;   // highlight this geo object (cursor pick / hazard - experimental)
+    gboolean     hazard;      // TRUE if a Safety Contour / hazard - use by leglin and GUARDZONE
+
+    // --- cold ---
     //guint        s52objID;     // optimisation: numeric value of OBCL string
 
     char         name[S57_GEO_NM_LN+1]; //  6 - object name    + '\0'
                                         //  8 - WOLDNM         + '\0'
                                         // 13 - ConnectedNode  + '\0'
 
-    S57_Obj_t    obj_t;       // PL & S57 - P/L/A
-
-    _rect        rect;        // lat/lon extent of this S75 object
-
     // length of geo data (POINT, LINE, AREA) currently in buffer
     guint        geoSize;        // max is 1 point / linexyznbr / ringxyznbr[0]
 
@@ -109,7 +153,12 @@ typedef struct _S57_geo {
     // in a format suitable for OpenGL
     S57_prim    *prim;
 
+    // level of detail 1..S57_LOD_NBR-1 (NULL if not worth it), level 0 is the data above
+    guint        lodCrnt;
+    _lod        *lod[S57_LOD_NBR];
+
     GData       *attribs;
+    _attTyped   *attTyped;    // CS attribute decoded (NULL if none)
 
 #ifdef S52_USE_C_AGGR_C_ASSO
     // point to the S57 relationship object C_AGGR / C_ASSO this S57_geo belong
@@ -124,8 +173,6 @@ typedef struct _S57_geo {
         S57_geo *DEPVAL; // break out objet class "touched"
     } touch;
 
-    double       scamin;
-
     // FIXME: SCAMAX
 
 #ifdef S52_USE_SUPP_LINE_OVERLAP
@@ -141,15 +188,15 @@ typedef struct _S57_geo {
     // optimisation mostly for layer 9 AREA
     guint        centroidIdx;
     GArray      *centroid;
+    _rect        centroidView;  // PRJ view when centroid computed (x1 INFINITY: none)
+
+    // pole of inaccessibility (polylabel) of AREAS - PRJ
+    gboolean     poleDone;
+    pt2          pole;
 
 #ifdef S52_USE_WORLD
     S57_geo     *nextPoly;
 #endif
-
-    gboolean     highlight;  // highlight this geo object (cursor pick / hazard - experimental)
-
-    gboolean     hazard;     // TRUE if a Safety Contour / hazard - use by leglin and GUARDZONE
-
 } _S57_geo;
 
 static GString *_attList = NULL;
@@ -191,12 +238,111 @@ static int    _doneGeoData(_S57_geo *geo)
         geo->ringxyznbr = NULL;
     }
 
+    // LOD
+    for (guint l=1; l<S57_LOD_NBR; ++l) {
+        _lod *lod = geo->lod[l];
+        if (NULL == lod)
+            continue;
+
+        guint nr = (S57_LINES_T == geo->obj_t) ? 1 : geo->ringnbr;
+        for (guint i=0; i<nr; ++i)
+            g_free(lod->ringxyz[i]);
+        g_free(lod->ringxyz);
+        g_free(lod->ringxyznbr);
+        if (NULL != lod->prim)
+            S57_donePrim(lod->prim);
+        g_free(lod);
+
+        geo->lod[l] = NULL;
+    }
+    geo->lodCrnt = 0;
+
     geo->linexyznbr = 0;
     geo->ringnbr    = 0;
 
     return TRUE;
 }
 
+static guint      _newS57ID(void)
+// return a new S57ID, 0 if slot map full
+{
+    guint slot = 0;
+
+    if (NULL == _S57IDgen) {
+        _S57IDgen  = g_array_new(FALSE, TRUE,  sizeof(guint16));
+        _S57IDfree = g_array_new(FALSE, FALSE, sizeof(guint));
+        g_array_set_size(_S57IDgen, 1);  // skip slot 0
+    }
+
+    // reuse a free slot - or any when the slot map is full
+    guint nfree = _S57IDfree->len - _S57IDhead;
+    if ((S57ID_FREE_MIN<=nfree) || ((0<nfree) && (S57ID_SLOT_MASK<_S57IDgen->len))) {
+        slot = g_array_index(_S57IDfree, guint, _S57IDhead);
+        ++_S57IDhead;
+
+        // compact the queue
+        if ((S57ID_FREE_MIN <= _S57IDhead) && ((_S57IDfree->len / 2) <= _S57IDhead)) {
+            g_array_remove_range(_S57IDfree, 0, _S57IDhead);
+            _S57IDhead = 0;
+        }
+    } else {
+        slot = _S57IDgen->len;
+        if (S57ID_SLOT_MASK < slot) {
+            PRINTF("ERROR: S57ID slot map full (%u)\n", slot);
+            g_assert(0);
+            return 0;
+        }
+        g_array_set_size(_S57IDgen, slot+1);
+    }
+
+    ++_S57IDlive;
+
+    return ((guint)g_array_index(_S57IDgen, guint16, slot) << S57ID_SLOT_BITS) | slot;
+}
+
+static int        _delS57ID(guint S57ID)
+// release the slot of this S57ID, bump its generation
+{
+    guint slot = S57ID & S57ID_SLOT_MASK;
+
+    if (0==slot || NULL==_S57IDgen || slot>=_S57IDgen->len)
+        return FALSE;
+
+    guint16 *gen = &g_array_index(_S57IDgen, guint16, slot);
+    *gen = (*gen + 1) & S57ID_GEN_MASK;
+    g_array_append_val(_S57IDfree, slot);
+    --_S57IDlive;
+
+    return TRUE;
+}
+
+guint      S57_getS57IDslot(guint S57ID)
+{
+    return S57ID & S57ID_SLOT_MASK;
+}
+
+int        S57_statS57ID(void)
+// debug - slot map usage and process RSS
+// soak: create / delete mariner obj in a loop (ex. AIS vessel, VRM/EBL), call this every N obj,
+// 'slot' and RSS must stay flat (before the slot map S57ID and _objList grew without bound)
+{
+    gchar *statm = NULL;
+    long   rss   = -1;   // page
+
+    if (TRUE == g_file_get_contents("/proc/self/statm", &statm, NULL, NULL)) {
+        sscanf(statm, "%*d %ld", &rss);
+        g_free(statm);
+    }
+
+    PRINTF("S57ID: %u live, %u free, %u slot, RSS: %ld page\n",
+           _S57IDlive,
+           (NULL == _S57IDfree) ? 0 : _S57IDfree->len - _S57IDhead,
+           (NULL == _S57IDgen)  ? 0 : _S57IDgen->len,
+           rss);
+
+    return TRUE;
+}
+
 int        S57_doneData   (_S57_geo *geo, gpointer user_data)
 {
     // quiet line overlap analysis that trigger a bunch of harmless warning
@@ -220,9 +366,13 @@ int        S57_doneData   (_S57_geo *geo, gpointer user_data)
     if (NULL != geo->attribs)
         g_datalist_clear(&geo->attribs);
 
+    g_free(geo->attTyped);
+
     if (NULL != geo->centroid)
         g_array_free(geo->centroid, TRUE);
 
+    _delS57ID(geo->S57ID);
+
     g_free(geo);
 
     return TRUE;
@@ -435,6 +585,10 @@ int        S57_geo2prj(_S57_geo *geo)
     if (TRUE == _doInit)
         S57_initPROJ();
 
+    // coords change
+    geo->poleDone = FALSE;
+    geo->centroidView.x1 = INFINITY;
+
 #ifdef S52_USE_PROJ
     guint nr = S57_getRingNbr(geo);
     for (guint i=0; i<nr; ++i) {
@@ -459,7 +613,7 @@ S57_geo   *S57_setPOINT(geocoord *xyz)
     if (NULL == geo)
         g_assert(0);
 
-    geo->S57ID    = _S57ID++;
+    geo->S57ID    = _newS57ID();
     geo->obj_t    = S57_POINT_T;
     geo->pointxyz = xyz;
 
@@ -500,7 +654,7 @@ S57_geo   *S57_setLINES(guint xyznbr, geocoord *xyz)
 
     return_if_null(geo);
 
-    geo->S57ID      = _S57ID++;
+    geo->S57ID      = _newS57ID();
     geo->obj_t      = S57_LINES_T;
     geo->linexyznbr = xyznbr;
     geo->linexyz    = xyz;
@@ -553,7 +707,7 @@ S57_geo   *S57_setAREAS(guint ringnbr, guint *ringxyznbr, geocoord **ringxyz)
     if (NULL == geo)
         g_assert(0);
 
-    geo->S57ID      = _S57ID++;
+    geo->S57ID      = _newS57ID();
     geo->obj_t      = S57_AREAS_T;
     geo->ringnbr    = ringnbr;
     geo->ringxyznbr = ringxyznbr;
@@ -586,7 +740,7 @@ S57_geo   *S57_set_META()
     if (NULL == geo)
         g_assert(0);
 
-    geo->S57ID   = _S57ID++;
+    geo->S57ID   = _newS57ID();
     geo->obj_t   = S57__META_T;
 
     geo->rect.x1 =  INFINITY;
@@ -662,6 +816,15 @@ int        S57_getGeoData(_S57_geo *geo, guint ringNo, guint *npt, double **ppt)
         return FALSE;
     }
 
+    // simplified coords of the current level of detail
+    if (0 < geo->lodCrnt) {
+        _lod *lod = geo->lod[geo->lodCrnt];
+        *npt = lod->ringxyznbr[ringNo];
+        *ppt = lod->ringxyz[ringNo];
+
+        return TRUE;
+    }
+
     switch (geo->obj_t) {
         case S57__META_T: *npt = 0; break;        // meta geo stuff (ex: C_AGGR)
 
@@ -733,6 +896,8 @@ S57_prim  *S57_initPrim(_S57_prim *prim)
     } else {
         g_array_set_size(prim->list,   0);
         g_array_set_size(prim->vertex, 0);
+        prim->orig[0] = 0.0;
+        prim->orig[1] = 0.0;
 
         return prim;
     }
@@ -759,16 +924,28 @@ S57_prim  *S57_donePrim(_S57_prim *prim)
     return NULL;
 }
 
+static S57_prim **_getPrimGeo(_S57_geo *geo)
+// prim of the current level of detail
+{
+    if (0 < geo->lodCrnt)
+        return &geo->lod[geo->lodCrnt]->prim;
+
+    return &geo->prim;
+}
+
 S57_prim  *S57_initPrimGeo(_S57_geo *geo)
 {
     return_if_null(geo);
 
-    geo->prim = S57_initPrim(geo->prim);
+    S57_prim **prim = _getPrimGeo(geo);
 
-    return geo->prim;
+    *prim = S57_initPrim(*prim);
+
+    return *prim;
 }
 
 S57_geo   *S57_donePrimGeo(_S57_geo *geo)
+// done prim of all level of detail
 {
     return_if_null(geo);
 
@@ -777,6 +954,13 @@ S57_geo   *S57_donePrimGeo(_S57_geo *geo)
         geo->prim = NULL;
     }
 
+    for (guint l=1; l<S57_LOD_NBR; ++l) {
+        if (NULL!=geo->lod[l] && NULL!=geo->lod[l]->prim) {
+            S57_donePrim(geo->lod[l]->prim);
+            geo->lod[l]->prim = NULL;
+        }
+    }
+
     return NULL;
 }
 
@@ -831,7 +1015,138 @@ S57_prim  *S57_getPrimGeo(_S57_geo *geo)
 {
     return_if_null(geo);
 
-    return geo->prim;
+    return *_getPrimGeo(geo);
+}
+
+static guint      _snapRing(guint npt, geocoord *ppt, double tol, geocoord *out)
+// snap coords to a grid of 'tol' meters and drop repeated coords
+// Note: a coords always snap to the same grid node, so an edge shared by
+// two objects (ex: DEPARE) is simplified the same way in both (no gap)
+{
+    guint n = 0;
+    for (guint i=0; i<npt; ++i, ppt+=3) {
+        double x = floor(ppt[0]/tol + 0.5) * tol;
+        double y = floor(ppt[1]/tol + 0.5) * tol;
+
+        if (0<n && x==out[(n-1)*3+0] && y==out[(n-1)*3+1])
+            continue;
+
+        out[n*3+0] = x;
+        out[n*3+1] = y;
+        out[n*3+2] = ppt[2];  // keep S57_OVERLAP_GEO_Z
+        ++n;
+    }
+
+    return n;
+}
+
+int        S57_newLOD(_S57_geo *geo)
+// build the level of detail of LINES / AREAS from projected coords
+// a level is kept only if it save at least 1/4 of the coords of the level below
+{
+    return_if_null(geo);
+
+    if (S57_LINES_T!=geo->obj_t && S57_AREAS_T!=geo->obj_t)
+        return FALSE;
+
+    // already done
+    for (guint l=1; l<S57_LOD_NBR; ++l) {
+        if (NULL != geo->lod[l])
+            return TRUE;
+    }
+
+    guint nr    = S57_getRingNbr(geo);
+    guint total = 0;
+    for (guint i=0; i<nr; ++i) {
+        guint   npt = 0;
+        double *ppt = NULL;
+        if (TRUE == S57_getGeoData(geo, i, &npt, &ppt))
+            total += npt;
+    }
+    if (0 == total)
+        return FALSE;
+
+    guint prevTotal = total;
+    for (guint l=1; l<S57_LOD_NBR; ++l) {
+        _lod *lod       = g_new0(_lod, 1);
+        lod->ringxyznbr = g_new0(guint,      nr);
+        lod->ringxyz    = g_new0(geocoord *, nr);
+
+        guint n = 0;
+        for (guint i=0; i<nr; ++i) {
+            guint   npt = 0;
+            double *ppt = NULL;
+            S57_getGeoData(geo, i, &npt, &ppt);
+
+            lod->ringxyz[i]    = g_new(geocoord, npt*3);
+            lod->ringxyznbr[i] = _snapRing(npt, ppt, _lodTol[l], lod->ringxyz[i]);
+
+            // degenerated - keep coords of the level below
+            if (lod->ringxyznbr[i] < ((S57_LINES_T == geo->obj_t) ? 2 : 4)) {
+                memcpy(lod->ringxyz[i], ppt, sizeof(geocoord) * npt * 3);
+                lod->ringxyznbr[i] = npt;
+            }
+
+            n += lod->ringxyznbr[i];
+        }
+
+        // not worth it
+        if (n*4 > prevTotal*3) {
+            for (guint i=0; i<nr; ++i)
+                g_free(lod->ringxyz[i]);
+            g_free(lod->ringxyz);
+            g_free(lod->ringxyznbr);
+            g_free(lod);
+            continue;
+        }
+
+        lod->saved    = total - n;
+        geo->lod[l]   = lod;
+        prevTotal     = n;
+
+        // next level start from this one
+        geo->lodCrnt  = l;
+    }
+
+    geo->lodCrnt = 0;
+
+    return TRUE;
+}
+
+guint      S57_setLOD(_S57_geo *geo, guint lod)
+// set the level of detail used by S57_getGeoData() and S57_*PrimGeo()
+// return the level set - the best level built that is not above 'lod'
+{
+    return_if_null(geo);
+
+    if (S57_LOD_NBR <= lod)
+        lod = S57_LOD_NBR - 1;
+
+    while (0<lod && NULL==geo->lod[lod])
+        --lod;
+
+    geo->lodCrnt = lod;
+
+    return lod;
+}
+
+guint      S57_getLODsaved(_S57_geo *geo)
+// number of coords not drawn at the current level of detail
+{
+    return_if_null(geo);
+
+    if (0 == geo->lodCrnt)
+        return 0;
+
+    return geo->lod[geo->lodCrnt]->saved;
+}
+
+double     S57_getLODtol(guint lod)
+{
+    if (S57_LOD_NBR <= lod)
+        return INFINITY;
+
+    return _lodTol[lod];
 }
 
 guint      S57_getPrimData(_S57_prim *prim, guint *primNbr, vertex_t **vert, guint *vertNbr, guint *vboID)
@@ -863,6 +1178,26 @@ int        S57_setPrimDList (_S57_prim *prim, guint DList)
     return TRUE;
 }
 
+int        S57_setPrimOrig  (_S57_prim *prim, double  x, double  y)
+{
+    return_if_null(prim);
+
+    prim->orig[0] = x;
+    prim->orig[1] = y;
+
+    return TRUE;
+}
+
+int        S57_getPrimOrig  (_S57_prim *prim, double *x, double *y)
+{
+    return_if_null(prim);
+
+    *x = prim->orig[0];
+    *y = prim->orig[1];
+
+    return TRUE;
+}
+
 int        S57_getPrimIdx(_S57_prim *prim, unsigned int i, int *mode, int *first, int *count)
 //int        S57_getPrimIdx(_S57_prim *prim, guint i, guint *mode, guint *first, guint *count)
 {
@@ -1028,20 +1363,29 @@ GString   *S57_getAttVal(_S57_geo *geo, const char *att_name)
     //GString *att = (GString*) g_dataset_id_get_data(&geo->attribs, g_quark_try_string(att_name));
     GQuark   q   = g_quark_from_string(att_name);
     //GQuark   q   = g_quark_from_static_string(att_name);
-    GString *att = (GString*) g_datalist_id_get_data(&geo->attribs, q);
+
+    return S57_getAttValQ(geo, q);
+}
+
+GString   *S57_getAttValQ(_S57_geo *geo, GQuark qname)
+// same as S57_getAttVal() but skip hashing the name (the caller hold the quark)
+{
+    return_if_null(geo);
+
+    GString *att = (GString*) g_datalist_id_get_data(&geo->attribs, qname);
 
     if (NULL!=att && (0==g_strcmp0(att->str, EMPTY_NUMBER_MARKER))) {
-        //PRINTF("NOTE: mandatory attribute (%s) with ommited value\n", att_name);
+        //PRINTF("NOTE: mandatory attribute (%s) with ommited value\n", g_quark_to_string(qname));
         return NULL;
     }
 
     // display this NOTE once (because of to many warning)
-    static int silent = FALSE;
-    if (!silent && NULL!=att && 0==att->len) {
+    // Note: CS worker thread get here (_lookUpLUP()), so test-and-set the flag
+    static volatile gint silent = FALSE;
+    if ((NULL!=att) && (0==att->len) && (TRUE==g_atomic_int_compare_and_exchange(&silent, FALSE, TRUE))) {
         //PRINTF("NOTE: attribute (%s) has no value [obj:%s]\n", att_name, geo->name->str);
-        PRINTF("NOTE: attribute (%s) has no value [obj:%s]\n", att_name, geo->name);
+        PRINTF("NOTE: attribute (%s) has no value [obj:%s]\n", g_quark_to_string(qname), geo->name);
         PRINTF("      (this msg will not repeat)\n");
-        silent = TRUE;
         return NULL;
     }
 
@@ -1053,6 +1397,94 @@ static void _string_free(gpointer data)
     g_string_free((GString*)data, TRUE);
 }
 
+static int        _setAttTyped(_S57_geo *geo, GQuark qname, const char *val)
+// decode attribute used by CS once (instead of at each CS pass)
+{
+    // init quark
+    if (0 == _attDq[0]) {
+        for (int i=0; i<S57_ATT_D_NBR; ++i) _attDq[i] = g_quark_from_static_string(_attDname[i]);
+        for (int i=0; i<S57_ATT_L_NBR; ++i) _attLq[i] = g_quark_from_static_string(_attLname[i]);
+    }
+
+    // same rule as S57_getAttVal(): no value - abscent
+    gboolean noval = ('\0'==*val || 0==g_strcmp0(val, EMPTY_NUMBER_MARKER));
+
+    for (int i=0; i<S57_ATT_D_NBR; ++i) {
+        if (qname != _attDq[i])
+            continue;
+
+        if (NULL == geo->attTyped)
+            geo->attTyped = g_new0(_attTyped, 1);
+
+        if (TRUE == noval) {
+            geo->attTyped->hasD &= ~(1u << i);
+        } else {
+            geo->attTyped->hasD   |= (1u << i);
+            geo->attTyped->valD[i] = S52_atof(val);
+        }
+
+        return TRUE;
+    }
+
+    for (int i=0; i<S57_ATT_L_NBR; ++i) {
+        if (qname != _attLq[i])
+            continue;
+
+        if (NULL == geo->attTyped)
+            geo->attTyped = g_new0(_attTyped, 1);
+
+        // same as _parseList() in S52CS.c
+        char *buf = geo->attTyped->valL[i];
+        int   n   = 0;
+        if (FALSE == noval) {
+            const char *str = val;
+            do {
+                if (n >= S57_ATT_LISTSIZE-1) {
+                    PRINTF("OVERFLOW - value in list lost!!\n");
+                    break;
+                }
+
+                buf[n++] = (unsigned char) S52_atoi(str);
+
+                // skip digit
+                while('0'<=*str && *str<='9')
+                    str++;
+
+            } while(*str++ != '\0');      // skip ',' or exit
+        }
+        buf[n] = '\0';
+        geo->attTyped->nL[i] = n;
+
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+gboolean   S57_getAttValD(_S57_geo *geo, S57_AttD att, double *val)
+{
+    return_if_null(geo);
+
+    if (NULL==geo->attTyped || 0==(geo->attTyped->hasD & (1u << att)))
+        return FALSE;
+
+    *val = geo->attTyped->valD[att];
+
+    return TRUE;
+}
+
+int        S57_getAttValL(_S57_geo *geo, S57_AttL att, char *buf)
+{
+    buf[0] = '\0';
+
+    if (NULL==geo || NULL==geo->attTyped || 0==geo->attTyped->nL[att])
+        return 0;
+
+    memcpy(buf, geo->attTyped->valL[att], geo->attTyped->nL[att]+1);
+
+    return geo->attTyped->nL[att];
+}
+
 // FIXME: returning GData useless
 GData     *S57_setAtt(_S57_geo *geo, const char *name, const char *val)
 {
@@ -1077,6 +1509,8 @@ GData     *S57_setAtt(_S57_geo *geo, const char *name, const char *val)
 
     g_datalist_id_set_data_full(&geo->attribs, qname, value, _string_free);
 
+    _setAttTyped(geo, qname, val);
+
     return geo->attribs;
 }
 
@@ -1317,7 +1751,7 @@ GCPTR      S57_getAtt(_S57_geo *geo)
     //PRINTF("NAME  : %s\n", geo->name);
 
     g_string_set_size(_attList, 0);
-    g_string_printf(_attList, "%s:%i", geo->name, geo->S57ID);
+    g_string_printf(_attList, "%s:%u", geo->name, geo->S57ID);
 
     g_datalist_foreach(&geo->attribs, _getAtt, _attList);
 
@@ -1577,6 +2011,10 @@ guint      S57_setGeoSize(_S57_geo *geo, guint size)
         return FALSE;
     }
 
+    // mariner's obj - coords change
+    geo->poleDone = FALSE;
+    geo->centroidView.x1 = INFINITY;
+
     return geo->geoSize = size;
 }
 
@@ -1593,6 +2031,37 @@ int        S57_newCentroid(_S57_geo *geo)
 
     geo->centroidIdx = 0;
 
+    geo->centroidView.x1 = INFINITY;
+
+    return TRUE;
+}
+
+int        S57_setCentroidView(_S57_geo *geo, double x1, double y1, double x2, double y2)
+// tag the centroids with the view they where computed for
+{
+    return_if_null(geo);
+
+    geo->centroidView.x1 = x1;
+    geo->centroidView.y1 = y1;
+    geo->centroidView.x2 = x2;
+    geo->centroidView.y2 = y2;
+
+    return TRUE;
+}
+
+int        S57_getCentroidView(_S57_geo *geo, double *x1, double *y1, double *x2, double *y2)
+// return FALSE if no centroids
+{
+    return_if_null(geo);
+
+    if ((NULL==geo->centroid) || (INFINITY==geo->centroidView.x1))
+        return FALSE;
+
+    *x1 = geo->centroidView.x1;
+    *y1 = geo->centroidView.y1;
+    *x2 = geo->centroidView.x2;
+    *y2 = geo->centroidView.y2;
+
     return TRUE;
 }
 
@@ -1641,6 +2110,249 @@ int        S57_hasCentroid(_S57_geo *geo)
     return TRUE;
 }
 
+// polylabel - pole of inaccessibility: the point inside the area the farthest from
+// its edges (rings), found by a best first search on a grid of cell
+// see https://github.com/mapbox/polylabel
+#define POLE_PRECISION   100.0  // stop when a cell can't improve by more than (extent / POLE_PRECISION)
+#define POLE_CELL_MAX   1000    // max cell visited - bound the search on huge area
+#define POLE_CELL_INI    250    // max cell of the initial grid - long thin area
+typedef struct _poleCell {
+    double x, y;                // center
+    double h;                   // half size
+    double d;                   // distance from center to rings (< 0 outside)
+    double max;                 // max distance possible in this cell
+} _poleCell;
+
+static double    _poleSegDist2(double px, double py, double *a, double *b)
+// squared distance from (px,py) to segment ab
+{
+    double x  = a[0];
+    double y  = a[1];
+    double dx = b[0] - x;
+    double dy = b[1] - y;
+
+    if ((0.0!=dx) || (0.0!=dy)) {
+        double t = ((px - x) * dx + (py - y) * dy) / (dx * dx + dy * dy);
+        if (t > 1.0) {
+            x = b[0];
+            y = b[1];
+        } else {
+            if (t > 0.0) {
+                x += dx * t;
+                y += dy * t;
+            }
+        }
+    }
+
+    dx = px - x;
+    dy = py - y;
+
+    return dx * dx + dy * dy;
+}
+
+static guint     _poleRingNpt(_S57_geo *geo, guint r)
+{
+    // mariner's obj - ring 0 is a buffer
+    if ((0==r) && (0<geo->geoSize) && (geo->geoSize<geo->ringxyznbr[0]))
+        return geo->geoSize;
+
+    return geo->ringxyznbr[r];
+}
+
+static double    _polePolyDist(_S57_geo *geo, double x, double y)
+// signed distance from (x,y) to all rings (exterior + holes) - > 0 inside
+{
+    int    inside = FALSE;
+    double d2min  = INFINITY;
+
+    for (guint r=0; r<geo->ringnbr; ++r) {
+        guint   npt = _poleRingNpt(geo, r);
+        double *ppt = geo->ringxyz[r];
+
+        for (guint i=0, j=npt-1; i<npt; j=i++) {
+            double *a = ppt + (i*3);
+            double *b = ppt + (j*3);
+
+            if (((a[1]>y) != (b[1]>y)) && (x < (b[0]-a[0]) * (y-a[1]) / (b[1]-a[1]) + a[0]))
+                inside = !inside;
+
+            double d2 = _poleSegDist2(x, y, a, b);
+            if (d2 < d2min)
+                d2min = d2;
+        }
+    }
+
+    return (TRUE==inside) ? sqrt(d2min) : -sqrt(d2min);
+}
+
+static _poleCell _poleNewCell(_S57_geo *geo, double x, double y, double h)
+{
+    _poleCell c = {x, y, h, 0.0, 0.0};
+
+    c.d   = _polePolyDist(geo, x, y);
+    c.max = c.d + h * M_SQRT2;
+
+    return c;
+}
+
+static void      _polePush(GArray *heap, _poleCell c)
+// max-heap on _poleCell.max
+{
+    g_array_append_val(heap, c);
+
+    _poleCell *h = (_poleCell *)heap->data;
+    for (guint i=heap->len-1; 0<i; ) {
+        guint p = (i-1) / 2;
+        if (h[p].max >= h[i].max)
+            break;
+        _poleCell t = h[p]; h[p] = h[i]; h[i] = t;
+        i = p;
+    }
+
+    return;
+}
+
+static _poleCell _polePop(GArray *heap)
+{
+    _poleCell *h   = (_poleCell *)heap->data;
+    _poleCell  top = h[0];
+
+    h[0] = h[heap->len-1];
+    g_array_set_size(heap, heap->len-1);
+
+    for (guint i=0; ; ) {
+        guint l = 2*i + 1;
+        guint r = 2*i + 2;
+        guint m = i;
+        if ((l<heap->len) && (h[l].max > h[m].max)) m = l;
+        if ((r<heap->len) && (h[r].max > h[m].max)) m = r;
+        if (m == i)
+            break;
+        _poleCell t = h[m]; h[m] = h[i]; h[i] = t;
+        i = m;
+    }
+
+    return top;
+}
+
+int        S57_newPole(_S57_geo *geo)
+// compute pole of inaccessibility of AREAS (call after S57_geo2prj())
+{
+    return_if_null(geo);
+
+    if ((S57_AREAS_T!=geo->obj_t) || (NULL==geo->ringxyznbr) || (0==geo->ringnbr))
+        return FALSE;
+
+    guint   npt = _poleRingNpt(geo, 0);
+    double *ppt = geo->ringxyz[0];
+    if (npt < 3)
+        return FALSE;
+
+    // extent of exterior ring
+    double x1 =  INFINITY, y1 =  INFINITY;
+    double x2 = -INFINITY, y2 = -INFINITY;
+    for (guint i=0; i<npt; ++i) {
+        double *p = ppt + (i*3);
+        x1 = MIN(x1, p[0]); y1 = MIN(y1, p[1]);
+        x2 = MAX(x2, p[0]); y2 = MAX(y2, p[1]);
+    }
+
+    double w    = x2 - x1;
+    double hgt  = y2 - y1;
+    double size = MIN(w, hgt);
+    double prec = MAX(w, hgt) / POLE_PRECISION;
+
+    // degenerated
+    if (0.0 == size) {
+        geo->pole.x   = (x1 + x2) / 2.0;
+        geo->pole.y   = (y1 + y2) / 2.0;
+        geo->poleDone = TRUE;
+        return TRUE;
+    }
+
+    // long thin area: coarser cell, leave some of POLE_CELL_MAX to refine the grid
+    size = MAX(size, sqrt((w * hgt) / POLE_CELL_INI));
+
+    GArray *heap = g_array_new(FALSE, FALSE, sizeof(_poleCell));
+
+    // cover the area with square cell
+    double h = size / 2.0;
+    for (double x=x1; x<x2; x+=size) {
+        for (double y=y1; y<y2; y+=size)
+            _polePush(heap, _poleNewCell(geo, x + h, y + h, h));
+    }
+
+    // first guess: area centroid, then extent center
+    _poleCell best;
+    {
+        double a  = 0.0;
+        double cx = 0.0;
+        double cy = 0.0;
+        for (guint i=0, j=npt-1; i<npt; j=i++) {
+            double *p1 = ppt + (i*3);
+            double *p2 = ppt + (j*3);
+            double  f  = (p1[0]-x1) * (p2[1]-y1) - (p2[0]-x1) * (p1[1]-y1);
+            cx += ((p1[0]-x1) + (p2[0]-x1)) * f;
+            cy += ((p1[1]-y1) + (p2[1]-y1)) * f;
+            a  += f * 3.0;
+        }
+        if (0.0 == a)
+            best = _poleNewCell(geo, ppt[0], ppt[1], 0.0);
+        else
+            best = _poleNewCell(geo, (cx / a) + x1, (cy / a) + y1, 0.0);
+
+        _poleCell bbox = _poleNewCell(geo, x1 + w/2.0, y1 + hgt/2.0, 0.0);
+        if (bbox.d > best.d)
+            best = bbox;
+    }
+
+    guint n = heap->len;
+    while (0 < heap->len) {
+        _poleCell c = _polePop(heap);
+
+        if (c.d > best.d)
+            best = c;
+
+        // can't do better in this cell - or search too long
+        if (((c.max - best.d) <= prec) || (POLE_CELL_MAX <= n))
+            continue;
+
+        h = c.h / 2.0;
+        _polePush(heap, _poleNewCell(geo, c.x - h, c.y - h, h));
+        _polePush(heap, _poleNewCell(geo, c.x + h, c.y - h, h));
+        _polePush(heap, _poleNewCell(geo, c.x - h, c.y + h, h));
+        _polePush(heap, _poleNewCell(geo, c.x + h, c.y + h, h));
+        n += 4;
+    }
+
+    g_array_free(heap, TRUE);
+
+    // debug
+    //PRINTF("DEBUG: %s pole: %f, %f (d:%f, cell:%i)\n", geo->name, best.x, best.y, best.d, n);
+
+    geo->pole.x   = best.x;
+    geo->pole.y   = best.y;
+    geo->poleDone = TRUE;
+
+    return TRUE;
+}
+
+int        S57_getPole(_S57_geo *geo, double *x, double *y)
+// computed on first call if not done at load (mariner's obj)
+{
+    return_if_null(geo);
+
+    if (FALSE == geo->poleDone) {
+        if (FALSE == S57_newPole(geo))
+            return FALSE;
+    }
+
+    *x = geo->pole.x;
+    *y = geo->pole.y;
+
+    return TRUE;
+}
+
 #ifdef S52_USE_SUPP_LINE_OVERLAP
 S57_geo   *S57_getEdgeOwner(_S57_geo *geoEdge)
 {
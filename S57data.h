@@ -104,6 +104,17 @@ guint     S57_getRingNbr(S57_geo *geo);
 // get data
 int       S57_getGeoData(S57_geo *geo, guint ringNo, guint *npt, double **ppt);
 
+// level of detail of LINES / AREAS (0 - full resolution)
+#define S57_LOD_NBR  4
+// build LOD from projected coords (call after S57_geo2prj())
+int       S57_newLOD(S57_geo *geo);
+// set current LOD seen by S57_getGeoData() / S57_*PrimGeo() - return the level set
+guint     S57_setLOD(S57_geo *geo, guint lod);
+// number of coords saved at the current LOD
+guint     S57_getLODsaved(S57_geo *geo);
+// tolerance (meter) of a LOD
+double    S57_getLODtol(guint lod);
+
 // handling of S52/S57 object rendering primitive
 S57_prim *S57_initPrim   (S57_prim *prim);
 S57_prim *S57_donePrim   (S57_prim *prim);
@@ -120,12 +131,16 @@ typedef double vertex_t;
 #endif
 int       S57_addPrimVertex(S57_prim *prim, vertex_t *ptr);
 
+// prim of the current level of detail
 S57_prim *S57_getPrimGeo   (S57_geo  *geo);
 guint     S57_getPrimData  (S57_prim *prim, guint *primNbr, vertex_t **vert, guint *vertNbr, guint *vboID);
 GArray   *S57_getPrimVertex(S57_prim *prim);
 int       S57_getPrimIdx   (S57_prim *prim, unsigned int i, int *mode, int *first, int *count);
 
 int       S57_setPrimDList (S57_prim *prim, guint DList);
+// origin (PRJ) of the vertex of this prim - vertex are relative to it (precision of float vertex)
+int       S57_setPrimOrig  (S57_prim *prim, double  x, double  y);
+int       S57_getPrimOrig  (S57_prim *prim, double *x, double *y);
 
 // get/set extend
 int       S57_setExt(S57_geo *geo, double  x1, double  y1, double  x2, double  y2);
@@ -139,6 +154,30 @@ S57_Obj_t S57_getObjtype(S57_geo *geo);
 
 // return S57 attribute value of the attribute name
 GString  *S57_getAttVal(S57_geo *geo, const char *name);
+// same as S57_getAttVal() but with the attribute name already a quark (PLib LUP matcher)
+GString  *S57_getAttValQ(S57_geo *geo, GQuark qname);
+
+// attribute used by CS, decoded once by S57_setAtt() (the string value is kept)
+typedef enum S57_AttD {     // numeric
+    S57_ATT_DRVAL1,
+    S57_ATT_DRVAL2,
+    S57_ATT_VALDCO,
+    S57_ATT_VALSOU,
+    S57_ATT_SECTR1,
+    S57_ATT_SECTR2,
+    S57_ATT_VALNMR,
+    S57_ATT_D_NBR
+} S57_AttD;
+typedef enum S57_AttL {     // list of number (< 256)
+    S57_ATT_CATLIT,
+    S57_ATT_COLOUR,
+    S57_ATT_L_NBR
+} S57_AttL;
+#define S57_ATT_LISTSIZE  16   // same as CS LISTSIZE
+// TRUE and set val if attribute present with a value (same as S57_getAttVal() != NULL)
+gboolean  S57_getAttValD(S57_geo *geo, S57_AttD att, double *val);
+// fill buf (S57_ATT_LISTSIZE, '\0' terminated) - return the number of value, 0 if abscent
+int       S57_getAttValL(S57_geo *geo, S57_AttL att, char *buf);
 // set attribute name and value
 GData    *S57_setAtt(S57_geo *geo, const char *name, const char *val);
 // get str of the form ",KEY1:VAL1,KEY2:VAL2, ..." of S57 attribute only (not OGR)
@@ -172,6 +211,10 @@ int       S57_getAttributes(S57_geo *geo, char **name, char **val);
 // debug
 int       S57_dumpData(S57_geo *geo, int dumpCoords);
 guint     S57_getGeoS57ID(S57_geo *geo);
+// slot of this S57ID (index in the S52_obj table), without the generation
+guint     S57_getS57IDslot(guint S57ID);
+// debug - report S57ID slot map and RSS
+int       S57_statS57ID(void);
 
 #ifdef S52_USE_PROJ
 #include <proj_api.h>   // projXY, projUV, projPJ
@@ -193,6 +236,13 @@ int       S57_newCentroid(S57_geo *geo);
 int       S57_addCentroid(S57_geo *geo, double  x, double  y);
 int       S57_getNextCentroid(S57_geo *geo, double *x, double *y);
 int       S57_hasCentroid(S57_geo *geo);
+// PRJ view the centroids where computed for - FALSE if none
+int       S57_setCentroidView(S57_geo *geo, double  x1, double  y1, double  x2, double  y2);
+int       S57_getCentroidView(S57_geo *geo, double *x1, double *y1, double *x2, double *y2);
+
+// pole of inaccessibility (polylabel) of AREAS (call after S57_geo2prj())
+int       S57_newPole(S57_geo *geo);
+int       S57_getPole(S57_geo *geo, double *x, double *y);
 
 #ifdef S52_USE_SUPP_LINE_OVERLAP
 S57_geo  *S57_getEdgeOwner(S57_geo *geoEdge);
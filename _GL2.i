@@ -34,6 +34,12 @@ static void        _glLineWidth(GLfloat);
 static void        _glPointSize(GLfloat);
 static inline void _checkError(const char *);
 static GLvoid      _DrawArrays_LINE_STRIP(guint, vertex_t *);  // debug pattern
+static int         _dirtyAddWin(double, double);
+static int         _dirtyPrj2win(GLfloat, GLfloat, GLfloat, GLfloat, const GLfloat *, double *, double *);
+#ifdef S52_USE_GL3
+static const char *_glslHeader_gl3(GLenum);
+static int         _init_gl3(void);
+#endif
 ////////////////////////////////////////////////////////
 
 
@@ -42,31 +48,68 @@ static GArray *_tessWorkBuf_d = NULL;
 // used to convert geo double to VBO float
 static GArray *_tessWorkBuf_f = NULL;
 
-// glsl main
-static GLint  _programObject  = 0;
-static GLuint _vertexShader   = 0;
-static GLuint _fragmentShader = 0;
+// glsl main - one program per shader variant, same source specialised by #define
+// so that a plain color fill doesn't pay for the branch of blit / stipple / pattern / glow / text
+typedef enum _SH {
+    SH_PLAIN,       // uColor only
+    SH_PATT,        // area pattern tile from atlas
+    SH_STIP,        // stipple line / raster - texture alpha, uColor rgb
+    SH_TEXT,        // text batch - texture alpha, vertex color rgb, pixel offset
+    SH_BLIT,        // texture as is
+    SH_GLOW,        // afterglow round point
+    SH_NUM          // number of variant
+} SH;
+
+static const char *_shDefs[SH_NUM] = {
+    "#define S52_SH_PLAIN \n",
+    "#define S52_SH_PATT  \n",
+    "#define S52_SH_STIP  \n#define S52_SH_TEX \n",
+    "#define S52_SH_TEXT  \n#define S52_SH_TEX \n",
+    "#define S52_SH_BLIT  \n#define S52_SH_TEX \n",
+    "#define S52_SH_GLOW  \n"
+};
 
-// glsl uniform
+// uniform location of each variant (unused uniform are optimised out: -1)
+typedef struct _shProg {
+    GLuint prog;
+    GLint  uProjection, uModelview, uOrigin, uColor, uPointSize, uSampler2d;
+    GLint  uPattGridX,  uPattGridY, uPattW,  uPattH, uPattAtlas;
+    GLint  uPixelSize;
+} _shProg;
+static _shProg _shProgs[SH_NUM];
+static SH      _shCrnt        = SH_PLAIN;
+
+static GLint   _programObject = 0;     // program of _shCrnt
+
+// uniform state carried over when switching variant
+static GLfloat _shColor[4]    = {0.0, 0.0, 0.0, 1.0};
+static GLfloat _shPointSize   = 1.0;
+static int     _glUseShader(SH);
+static void    _glUniformColor(GLfloat, GLfloat, GLfloat, GLfloat);
+
+// glsl uniform - location in the current variant
 static GLint _uProjection = 0;
 static GLint _uModelview  = 0;
+static GLint _uOrigin     = 0;
 static GLint _uColor      = 0;
 static GLint _uPointSize  = 0;
 static GLint _uSampler2d  = 0;
-static GLint _uBlitOn     = 0;
-static GLint _uStipOn     = 0;
-static GLint _uGlowOn     = 0;
 
-static GLint _uPattOn     = 0;
 static GLint _uPattGridX  = 0;
 static GLint _uPattGridY  = 0;
 static GLint _uPattW      = 0;
 static GLint _uPattH      = 0;
+static GLint _uPattAtlas  = 0;
+
+static GLint _uPixelSize  = 0;
 
-// glsl varying
+// glsl varying - bound before link, same location in all variant
 static GLint _aPosition    = 0;
-static GLint _aUV          = 0;
-static GLint _aAlpha       = 0;
+static GLint _aUV          = 1;
+static GLint _aAlpha       = 2;
+static GLint _aOffset      = 3;
+static GLint _aColor       = 4;
+#define S52_GL2_ATTRIB_INST  5         // aInstOffset (GL3)
 
 // alpha is 0.0 - 1.0
 #define TRNSP_FAC_GLES2   0.25
@@ -79,6 +122,35 @@ static GLint _aAlpha       = 0;
 // and the right most pixel in a byte is at 0xE0
 // 1 bit in _nodata_mask is 4 bytes (RGBA) in _rgba_nodata_mask (s0 x 8 bits x 4 )
 
+// AP atlas - all area pattern tile rendered in one texture shared by all obj
+// NOTE: tile are a mask (alpha only), color come from uColor - so color/palette are not part of the key
+#define S52_AP_ATLAS_SZ  1024     // atlas texture size (pixel)
+#define S52_AP_ATLAS_GUT    1     // gutter between tile (pixel) - stop GL_LINEAR bleeding
+typedef struct _apKey {
+    S52_DList *DListData;         // pattern definition (PLib)
+    double     tileWpx;           // tile size / stagger offset at the current dotpitch
+    double     tileHpx;
+    double     stagOffsetPix;
+    char       pen_w;
+} _apKey;
+typedef struct _apTile {
+    _apKey  key;
+    GLint   x, y;                 // origin of tile in atlas (pixel)
+    GLsizei w, h;                 // size of tile in atlas (pixel)
+    guint   refs;                 // number of obj using this tile
+} _apTile;
+static GLuint        _apAtlas_texID = 0;
+static GHashTable   *_apAtlas       = NULL;  // _apKey   --> _apTile
+static GHashTable   *_apAtlasUsers  = NULL;  // S52_obj* --> GSList of _apTile*
+static GLint         _apAtlasShelfX = 0;     // shelf packing
+static GLint         _apAtlasShelfY = 0;
+static GLint         _apAtlasShelfH = 0;
+static double        _apAtlasDotpitchX = 0.0; // dotpitch that the atlas was rendered with
+static double        _apAtlasDotpitchY = 0.0;
+// stat
+static guint         _nAPAtlasHit   = 0;
+static guint         _nAPAtlasMiss  = 0;
+
 // NODATA03
 static GLuint        _nodata_mask_texID = 0;
 static GLubyte       _nodata_mask_rgba[4*32*8*4]; // 32 * 32 * 4   // 8bits * 4col * 32row * 4rgba
@@ -202,9 +274,24 @@ typedef struct {
     GLfloat s, t;       // texture
 } _freetype_gl_vertex_t;
 
-// legend has no S52_obj, so this a place holder
-static GLuint  _freetype_gl_textureID = 0;
-static GArray *_freetype_gl_buffer    = NULL;
+// frame-level text batch: one vertex per glyph corner
+// anchor is in PRJ, the shader add the pixel offset after projection
+typedef struct {
+    GLfloat x, y;          // world anchor (PRJ)
+    GLfloat u, v;          // pen offset from anchor (pixel)
+    GLfloat s, t;          // texture
+    GLubyte r, g, b, a;    // colour
+} _freetype_gl_textVertex_t;
+
+// streaming VBO, re-filled once per frame by _flushTXTAA_gl2()
+static GLuint      _freetype_gl_textureID = 0;
+static GArray     *_freetype_gl_textBatch = NULL;   // all the glyph of this frame
+
+// glyph run cache: key "weight:str" --> GArray of _freetype_gl_vertex_t (pen coord)
+// Note: text is mostly static (name, depth, ..) so the run is the same from frame to frame
+static GHashTable *_freetype_gl_runCache  = NULL;
+static GString    *_freetype_gl_runKey    = NULL;
+#define S52_MAX_TXT_RUN  4096                       // reset cache when full
 
 #define LF  '\r'   // Line Feed
 #define TB  '\t'   // Tabulation
@@ -232,7 +319,8 @@ static int       _d2f(GArray *tessWorkBuf_f, unsigned int npt, double *ppt)
     g_array_set_size(tessWorkBuf_f, 0);
 
     for (guint i=0; i<npt; ++i) {
-        float f[3] = {ppt[0], ppt[1], 0.0};  // flush S57_OVERLAP_GEO_Z
+        // relative to the GPU origin, in double, before casting to float
+        float f[3] = {ppt[0] - _prjOrig.u, ppt[1] - _prjOrig.v, 0.0};  // flush S57_OVERLAP_GEO_Z
         g_array_append_val(tessWorkBuf_f, f);
         ppt += 3;
     }
@@ -309,8 +397,16 @@ static int       _init_freetype_gl(void)
         return FALSE;
     }
 
-    if (NULL == _freetype_gl_buffer) {
-        _freetype_gl_buffer = g_array_new(FALSE, FALSE, sizeof(_freetype_gl_vertex_t));
+    if (NULL == _freetype_gl_textBatch) {
+        _freetype_gl_textBatch = g_array_new(FALSE, FALSE, sizeof(_freetype_gl_textVertex_t));
+    }
+
+    // glyph metric change with the font, so start with an empty cache
+    if (NULL != _freetype_gl_runCache) {
+        g_hash_table_remove_all(_freetype_gl_runCache);
+    } else {
+        _freetype_gl_runCache = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, (GDestroyNotify)g_array_unref);
+        _freetype_gl_runKey   = g_string_new("");
     }
 
     return TRUE;
@@ -323,12 +419,11 @@ static GArray   *_fill_freetype_gl_buffer(GArray *ftglBuf, const char *str, unsi
     int   pen_x = 0;
     int   pen_y = 0;
     int   nl    = FALSE;
-    glong len   = g_utf8_strlen(str, -1);
 
     g_array_set_size(ftglBuf, 0);
 
-    for (glong i=0; i<len; ++i) {
-        gchar           *utfc  = g_utf8_offset_to_pointer(str, i);
+    // Note: walk the string once - g_utf8_offset_to_pointer() restart from 'str' at each char
+    for (const gchar *utfc=str; '\0'!=*utfc; utfc=g_utf8_next_char(utfc)) {
         gunichar         unic  = g_utf8_get_char(utfc);
         texture_glyph_t *glyph = texture_font_get_glyph(_freetype_gl_font[weight], unic);
         if (NULL == glyph) {
@@ -389,6 +484,29 @@ static GArray   *_fill_freetype_gl_buffer(GArray *ftglBuf, const char *str, unsi
     return ftglBuf;
 }
 
+static GArray   *_getGlyphRun_freetype_gl(const char *str, unsigned int weight)
+// return the glyph run of 'str' from the cache, fill and cache it if not found
+{
+    g_string_printf(_freetype_gl_runKey, "%u:%s", weight, str);
+
+    GArray *run = (GArray *)g_hash_table_lookup(_freetype_gl_runCache, _freetype_gl_runKey->str);
+    if (NULL != run)
+        return run;
+
+    // dynamic text (ex AIS label, time on pastrk) can fill the cache
+    if (S52_MAX_TXT_RUN < g_hash_table_size(_freetype_gl_runCache)) {
+        PRINTF("DEBUG: glyph run cache full, reset\n");
+        g_hash_table_remove_all(_freetype_gl_runCache);
+    }
+
+    run = g_array_new(FALSE, FALSE, sizeof(_freetype_gl_vertex_t));
+    run = _fill_freetype_gl_buffer(run, str, weight);
+
+    g_hash_table_insert(_freetype_gl_runCache, g_strdup(_freetype_gl_runKey->str), run);
+
+    return run;
+}
+
 //-----------------------------------------
 //
 // gles2 float Matrix stuff (by hand)
@@ -662,61 +780,101 @@ static void      _glRotated(double angle, double x, double y, double z)
     return;
 }
 
-static int       _renderTXTAA_gl2(double x, double y, GLfloat *data, guint len) 
-// render VBO static text (ie no data) or dynamic text
+static int       _renderTXTAA_gl2(double x, double y, double offx, double offy, S52_Color *color, GArray *run)
+// append a glyph run anchored at x,y (PRJ) to the frame text batch
+// offx/offy: pixel offset (ex shadow)
 {
-    // Note: static text could also come from MIO's (ie S52_GL_LAST cycle)
-    if ((NULL == data) &&
-        ((S52_GL_DRAW==_crnt_GL_cycle) || (S52_GL_LAST==_crnt_GL_cycle))) {
-#define BUFFER_OFFSET(i) ((char *)NULL + (i))
-        glEnableVertexAttribArray(_aPosition);
-        glVertexAttribPointer    (_aPosition, 3, GL_FLOAT, GL_FALSE, sizeof(_freetype_gl_vertex_t), BUFFER_OFFSET(0));
-
-        glEnableVertexAttribArray(_aUV);
-        glVertexAttribPointer    (_aUV,       2, GL_FLOAT, GL_FALSE, sizeof(_freetype_gl_vertex_t), BUFFER_OFFSET(sizeof(float)*3));
-    } else {
-        // connect ftgl buffer coord data to GPU
-        glEnableVertexAttribArray(_aPosition);
-        glVertexAttribPointer    (_aPosition, 3, GL_FLOAT, GL_FALSE, sizeof(_freetype_gl_vertex_t), data+0);
-
-        glEnableVertexAttribArray(_aUV);
-        glVertexAttribPointer    (_aUV,       2, GL_FLOAT, GL_FALSE, sizeof(_freetype_gl_vertex_t), data+3);
+    // same highlight rule as _setFragment() - keep the transparency of the color
+    char trans = color->trans;
+    if (TRUE == _doHighlight)
+        color = S52_PL_getColor("DNGHL");
+
+    // same alpha as _glColor4ub()
+    double alpha = (4 - (trans - '0')) * TRNSP_FAC_GLES2 * 255.0;
+    GLubyte a    = (GLubyte) CLAMP(alpha, 0.0, 255.0);
+
+    guint n = _freetype_gl_textBatch->len;
+    g_array_set_size(_freetype_gl_textBatch, n + run->len);
+
+    _freetype_gl_vertex_t     *src = (_freetype_gl_vertex_t     *)run->data;
+    _freetype_gl_textVertex_t *dst = &g_array_index(_freetype_gl_textBatch, _freetype_gl_textVertex_t, n);
+
+    // dirty rectangle - anchor in window + glyph pixel offset (modelview identity at flush)
+    double wx = 0.0;
+    double wy = 0.0;
+    int    dirty = (TRUE==_dirtyOn) && (TRUE==_dirtyPrj2win(x - _prjOrig.u, y - _prjOrig.v, 0.0, 0.0, NULL, &wx, &wy));
+
+    for (guint i=0; i<run->len; ++i, ++src, ++dst) {
+        dst->x = x - _prjOrig.u;
+        dst->y = y - _prjOrig.v;
+        dst->u = src->x + offx;
+        dst->v = src->y + offy;
+        dst->s = src->s;
+        dst->t = src->t;
+        dst->r = color->R;
+        dst->g = color->G;
+        dst->b = color->B;
+        dst->a = a;
+
+        if (TRUE == dirty)
+            _dirtyAddWin(wx + dst->u, wy + dst->v);
     }
 
-    // turn ON 'sampler2d'
-    glUniform1f(_uStipOn, 1.0);
-
-    glBindTexture(GL_TEXTURE_2D, _freetype_gl_atlas->id);
+    return TRUE;
+}
 
-    //_glMatrixMode  (GL_MODELVIEW);
-    _glLoadIdentity(GL_MODELVIEW);
+static int       _flushTXTAA_gl2(void)
+// draw all the text of this frame in one call
+{
+    if ((NULL==_freetype_gl_textBatch) || (0==_freetype_gl_textBatch->len))
+        return TRUE;
 
-    _glTranslated(x, y, 0.0);
+#define BUFFER_OFFSET(i) ((char *)NULL + (i))
+    // orphan the previous frame and upload this one
+    glBindBuffer(GL_ARRAY_BUFFER, _freetype_gl_textureID);
+    glBufferData(GL_ARRAY_BUFFER,
+                 _freetype_gl_textBatch->len * sizeof(_freetype_gl_textVertex_t),
+                 (const void *)_freetype_gl_textBatch->data,
+                 GL_STREAM_DRAW);
 
-    _pushScaletoPixel(FALSE);
+    glEnableVertexAttribArray(_aPosition);
+    glVertexAttribPointer    (_aPosition, 2, GL_FLOAT,         GL_FALSE, sizeof(_freetype_gl_textVertex_t), BUFFER_OFFSET(0));
+    glEnableVertexAttribArray(_aOffset);
+    glVertexAttribPointer    (_aOffset,   2, GL_FLOAT,         GL_FALSE, sizeof(_freetype_gl_textVertex_t), BUFFER_OFFSET(sizeof(GLfloat)*2));
+    glEnableVertexAttribArray(_aUV);
+    glVertexAttribPointer    (_aUV,       2, GL_FLOAT,         GL_FALSE, sizeof(_freetype_gl_textVertex_t), BUFFER_OFFSET(sizeof(GLfloat)*4));
+    glEnableVertexAttribArray(_aColor);
+    glVertexAttribPointer    (_aColor,    4, GL_UNSIGNED_BYTE, GL_TRUE,  sizeof(_freetype_gl_textVertex_t), BUFFER_OFFSET(sizeof(GLfloat)*6));
 
-    // horizontal text
-    _glRotated(-_north, 0.0, 0.0, 1.0);
+    _glUseShader(SH_TEXT);
+    glUniform2f(_uPixelSize, 2.0 / _vp.w, 2.0 / _vp.h);
 
-    glUniformMatrix4fv(_uModelview,  1, GL_FALSE, _mvm[_mvmTop]);
+    glBindTexture(GL_TEXTURE_2D, _freetype_gl_atlas->id);
 
-    glDrawArrays(GL_TRIANGLES, 0, len);
+    // anchor in PRJ, horizontal text come from the pixel offset
+    _glUniformMatrix4fv_uModelview();
 
-    _popScaletoPixel();
+    glDrawArrays(GL_TRIANGLES, 0, _freetype_gl_textBatch->len);
 
     glBindTexture(GL_TEXTURE_2D, 0);
-    glUniform1f(_uStipOn, 0.0);
+    _glUseShader(SH_PLAIN);
 
     // disconnect buffer
+    glDisableVertexAttribArray(_aColor);
     glDisableVertexAttribArray(_aUV);
+    glDisableVertexAttribArray(_aOffset);
     glDisableVertexAttribArray(_aPosition);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    g_array_set_size(_freetype_gl_textBatch, 0);
 
-    _checkError("_renderTXTAA_gl2() freetype-gl");
+    _checkError("_flushTXTAA_gl2() freetype-gl");
 
     return TRUE;
 }
 
-static GLuint    _loadShader(GLenum type, const char *shaderSrc) 
+static GLuint    _loadShader(GLenum type, const char *defs, const char *shaderSrc)
+// compile shaderSrc specialised by defs (shader variant)
 {
     GLint compiled = GL_FALSE;
 
@@ -728,7 +886,14 @@ static GLuint    _loadShader(GLenum type, const char *shaderSrc)
         return FALSE;
     }
 
-    glShaderSource(shader, 1, &shaderSrc, NULL);
+#ifdef S52_USE_GL3
+    // same source, GLSL 3.x header - '#version' must come first
+    const char *src[3] = {_glslHeader_gl3(type), defs, shaderSrc};
+#else
+    const char *src[3] = {"", defs, shaderSrc};
+#endif
+
+    glShaderSource(shader, 3, src, NULL);
     glCompileShader(shader);
     glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
 
@@ -752,6 +917,125 @@ static GLuint    _loadShader(GLenum type, const char *shaderSrc)
     return shader;
 }
 
+static int       _glUseShader(SH sh)
+// switch to program of variant 'sh' - no-op if allready in use
+{
+    if (sh == _shCrnt)
+        return TRUE;
+
+    _shProg *p = &_shProgs[sh];
+    if (0 == p->prog) {
+        PRINTF("WARNING: shader variant %i not built\n", sh);
+        return FALSE;
+    }
+
+    glUseProgram(p->prog);
+    _shCrnt        = sh;
+    _programObject = p->prog;
+
+    _uProjection = p->uProjection;
+    _uModelview  = p->uModelview;
+    _uOrigin     = p->uOrigin;
+    _uColor      = p->uColor;
+    _uPointSize  = p->uPointSize;
+    _uSampler2d  = p->uSampler2d;
+    _uPattGridX  = p->uPattGridX;
+    _uPattGridY  = p->uPattGridY;
+    _uPattW      = p->uPattW;
+    _uPattH      = p->uPattH;
+    _uPattAtlas  = p->uPattAtlas;
+    _uPixelSize  = p->uPixelSize;
+
+    // uniform are per program - carry over the state set before the switch
+    // (GL3: uProjection is in the 'Frame' UBO, location -1 is a no-op)
+    glUniformMatrix4fv(_uProjection, 1, GL_FALSE, _pjm[_pjmTop]);
+    glUniformMatrix4fv(_uModelview,  1, GL_FALSE, _mvm[_mvmTop]);
+    glUniform4fv(_uColor, 1, _shColor);
+    glUniform1f (_uPointSize, _shPointSize);
+
+    return TRUE;
+}
+
+static void      _glUniformColor(GLfloat r, GLfloat g, GLfloat b, GLfloat a)
+{
+    _shColor[0] = r;
+    _shColor[1] = g;
+    _shColor[2] = b;
+    _shColor[3] = a;
+
+    glUniform4fv(_uColor, 1, _shColor);
+
+    return;
+}
+
+static int       _linkShader(SH sh, const char *vertSrc, const char *fragSrc)
+// build program of variant 'sh' and get its uniform location
+{
+    _shProg *p    = &_shProgs[sh];
+    GLint linked  = GL_FALSE;
+
+    p->prog = glCreateProgram();
+    if (0 == p->prog) {
+        PRINTF("ERROR: glCreateProgram() FAILED\n");
+        g_assert(0);
+        return FALSE;
+    }
+
+    GLuint vertShader = _loadShader(GL_VERTEX_SHADER,   _shDefs[sh], vertSrc);
+    GLuint fragShader = _loadShader(GL_FRAGMENT_SHADER, _shDefs[sh], fragSrc);
+    if ((0==vertShader) || (0==fragShader)) {
+        PRINTF("ERROR: problem loading shaders variant %i\n", sh);
+        g_assert(0);
+        return FALSE;
+    }
+
+    glAttachShader(p->prog, vertShader);
+    glAttachShader(p->prog, fragShader);
+
+    // same attribute location in all variant - VBO/VAO setup don't depend on the program
+    glBindAttribLocation(p->prog, _aPosition, "aPosition");
+    glBindAttribLocation(p->prog, _aUV,       "aUV");
+    glBindAttribLocation(p->prog, _aAlpha,    "aAlpha");
+    glBindAttribLocation(p->prog, _aOffset,   "aOffset");
+    glBindAttribLocation(p->prog, _aColor,    "aColor");
+#ifdef S52_USE_GL3
+    glBindAttribLocation(p->prog, S52_GL2_ATTRIB_INST, "aInstOffset");
+#endif
+
+    glLinkProgram (p->prog);
+    glGetProgramiv(p->prog, GL_LINK_STATUS, &linked);
+
+    // flagged for deletion, go with the program
+    glDeleteShader(vertShader);
+    glDeleteShader(fragShader);
+
+    if (GL_FALSE == linked){
+        GLsizei length;
+        GLchar  infoLog[2048];
+
+        glGetProgramInfoLog(p->prog,  2048, &length, infoLog);
+        PRINTF("problem linking program variant %i:%s", sh, infoLog);
+
+        g_assert(0);
+        return FALSE;
+    }
+
+    p->uProjection = glGetUniformLocation(p->prog, "uProjection");
+    p->uModelview  = glGetUniformLocation(p->prog, "uModelview");
+    p->uOrigin     = glGetUniformLocation(p->prog, "uOrigin");
+    p->uColor      = glGetUniformLocation(p->prog, "uColor");
+    p->uPointSize  = glGetUniformLocation(p->prog, "uPointSize");
+    p->uSampler2d  = glGetUniformLocation(p->prog, "uSampler2d");
+    p->uPattGridX  = glGetUniformLocation(p->prog, "uPattGridX");
+    p->uPattGridY  = glGetUniformLocation(p->prog, "uPattGridY");
+    p->uPattW      = glGetUniformLocation(p->prog, "uPattW");
+    p->uPattH      = glGetUniformLocation(p->prog, "uPattH");
+    p->uPattAtlas  = glGetUniformLocation(p->prog, "uPattAtlas");
+    p->uPixelSize  = glGetUniformLocation(p->prog, "uPixelSize");
+
+    return TRUE;
+}
+
 static int       _1024bitMask2RGBATex(const GLubyte *mask, GLubyte *rgba_mask) 
 // make a RGBA texture from 32x32 bitmask (those used by glPolygonStipple() in OpenGL 1.x)
 {
@@ -880,7 +1164,6 @@ static int       _init_gl2(void)
         _tessWorkBuf_f = g_array_new(FALSE, FALSE, sizeof(float)*3);
 
     if (FALSE == glIsProgram(_programObject)) {
-        GLint linked = GL_FALSE;
 
 #ifdef S52_USE_FREETYPE_GL
         _init_freetype_gl();
@@ -889,17 +1172,7 @@ static int       _init_gl2(void)
         _initTexture();
 
         // ----------------------------------------------------------------------
-
-        PRINTF("DEBUG: building '_programObject'\n");
-        _programObject = glCreateProgram();
-        if (0 == _programObject) {
-            PRINTF("ERROR: glCreateProgram() FAILED\n");
-            g_assert(0);
-            return FALSE;
-        }
-
-        // ----------------------------------------------------------------------
-        PRINTF("DEBUG: GL_VERTEX_SHADER\n");
+        // one source, specialised at compile time by S52_SH_* (see _shDefs[])
 
         static const char vertSrc[] =
 //#if (defined(S52_USE_GL2) || defined(S52_USE_GLES2))
@@ -908,10 +1181,20 @@ static int       _init_gl2(void)
             "precision mediump float;                                       \n"
             //"precision highp   float;                                       \n"
 #endif
+            // GL3 - frame constant in a uniform buffer
+            "#ifdef S52_GL3                                                 \n"
+            "layout(std140) uniform Frame {                                 \n"
+            "    mat4  uProjection;                                         \n"
+            "    vec2  uPixelSize;                                          \n"
+            "};                                                             \n"
+            "attribute vec2  aInstOffset;                                   \n"
+            "#else                                                          \n"
             "uniform   mat4  uProjection;                                   \n"
+            "uniform   vec2  uPixelSize;                                    \n"
+            "#endif                                                         \n"
             "uniform   mat4  uModelview;                                    \n"
+            "uniform   vec2  uOrigin;                                       \n"
             "uniform   float uPointSize;                                    \n"
-            "uniform   float uPattOn;                                       \n"
             "uniform   float uPattGridX;                                    \n"
             "uniform   float uPattGridY;                                    \n"
             "uniform   float uPattW;                                        \n"
@@ -920,10 +1203,11 @@ static int       _init_gl2(void)
             "attribute vec2  aUV;                                           \n"
             "attribute vec4  aPosition;                                     \n"
             "attribute float aAlpha;                                        \n"
+            "attribute vec2  aOffset;                                       \n"
+            "attribute vec4  aColor;                                        \n"
 
             "varying   vec2  v_texCoord;                                    \n"
             "varying   vec4  v_acolor;                                      \n"
-            "varying   float v_pattOn;                                      \n"
             "varying   float v_alpha;                                       \n"
 
             "void main(void)                                                \n"
@@ -932,23 +1216,34 @@ static int       _init_gl2(void)
             //"  gl_Position = ftransform(); \n"
             //"  vec4 TexCoord = gl_MultiTexCoord0; \n"
 
-            "    v_alpha      = aAlpha;                                     \n"
+            // vertex relative to prim origin, origin relative to view centre
+            "    vec4 pos     = aPosition + vec4(uOrigin, 0.0, 0.0);        \n"
             "    gl_PointSize = uPointSize;                                 \n"
-            "    gl_Position  = uProjection * uModelview * aPosition;       \n"
-            "    if (1.0 == uPattOn) {                                      \n"
-            "        v_texCoord.x = (aPosition.x - uPattGridX) / uPattW;    \n"
-            "        v_texCoord.y = (aPosition.y - uPattGridY) / uPattH;    \n"
-            "    } else {                                                   \n"
-            "        v_texCoord = aUV;                                      \n"
-            "    }                                                          \n"
+            "#ifdef S52_GL3                                                 \n"
+            // instance offset in world (symbol repeated along a line)
+            "    gl_Position  = uProjection * (uModelview * pos + vec4(aInstOffset, 0.0, 0.0));\n"
+            "#else                                                          \n"
+            "    gl_Position  = uProjection * uModelview * pos;             \n"
+            "#endif                                                         \n"
+            "#ifdef S52_SH_GLOW                                             \n"
+            "    v_alpha      = aAlpha;                                     \n"
+            "#endif                                                         \n"
+            // text batch: pixel offset from the projected anchor
+            "#ifdef S52_SH_TEXT                                             \n"
+            "    gl_Position.xy += aOffset * uPixelSize * gl_Position.w;    \n"
+            "    v_acolor        = aColor;                                  \n"
+            "#endif                                                         \n"
+            "#ifdef S52_SH_PATT                                             \n"
+            "    v_texCoord.x = (pos.x - uPattGridX) / uPattW;              \n"
+            "    v_texCoord.y = (pos.y - uPattGridY) / uPattH;              \n"
+            "#endif                                                         \n"
+            "#ifdef S52_SH_TEX                                              \n"
+            "    v_texCoord = aUV;                                          \n"
+            "#endif                                                         \n"
             "}                                                              \n";
 
-        _vertexShader = _loadShader(GL_VERTEX_SHADER, vertSrc);
-
         // ----------------------------------------------------------------------
 
-        PRINTF("DEBUG: GL_FRAGMENT_SHADER\n");
-
 /*
 #ifdef S52_USE_TEGRA2
         // FIXME: does this really help with blending on a TEGRA2
@@ -979,128 +1274,73 @@ static int       _init_gl2(void)
             "precision mediump float;                   \n"
 #endif
             "uniform sampler2D uSampler2d;              \n"
-            "uniform float     uFlatOn;                 \n"
-            "uniform float     uBlitOn;                 \n"
-            "uniform float     uStipOn;                 \n"
-            "uniform float     uPattOn;                 \n"
-            "uniform float     uGlowOn;                 \n"
 
             //"uniform float     uFxAAOn;                 \n"
 
             "uniform vec4      uColor;                  \n"
+            "uniform vec4      uPattAtlas;              \n"
 
             "varying vec2      v_texCoord;              \n"
             "varying float     v_alpha;                 \n"
+            "varying vec4      v_acolor;                \n"
 
-            // NOTE: if else if ... doesn't seem to slow things down
+            // NOTE: no runtime branch, each variant is its own program
             "void main(void)                            \n"
             "{                                          \n"
-            "    if (1.0 == uBlitOn) {                  \n"
-            "        gl_FragColor = texture2D(uSampler2d, v_texCoord);               \n"
-            "    } else {                                                            \n"
-            // FIXME: uStipOn and uPattOn same - diff might be usefull later on ..
-            "        if (1.0 == uStipOn) {                                           \n"
-            "            gl_FragColor = texture2D(uSampler2d, v_texCoord);           \n"
-            "            gl_FragColor.rgb = uColor.rgb;                              \n"
-            "        } else {                                                        \n"
-            "            if (1.0 == uPattOn) {                                       \n"
-            "                gl_FragColor = texture2D(uSampler2d, v_texCoord);       \n"
-            "                gl_FragColor.rgb = uColor.rgb;                          \n"
-            "            } else {                                                    \n"
+            "#if   defined(S52_SH_BLIT)                 \n"
+            "    gl_FragColor = texture2D(uSampler2d, v_texCoord);                   \n"
+            "#elif defined(S52_SH_TEXT)                                              \n"
+            "    gl_FragColor     = texture2D(uSampler2d, v_texCoord);               \n"
+            "    gl_FragColor.rgb = v_acolor.rgb;                                    \n"
+            "    gl_FragColor.a  *= v_acolor.a;                                      \n"
+            "#elif defined(S52_SH_STIP)                                              \n"
+            "    gl_FragColor     = texture2D(uSampler2d, v_texCoord);               \n"
+            "    gl_FragColor.rgb = uColor.rgb;                                      \n"
+            "#elif defined(S52_SH_PATT)                                              \n"
+            // tile origin / size in atlas - fract() does the GL_REPEAT of the tile
+            "    gl_FragColor = texture2D(uSampler2d, uPattAtlas.xy + fract(v_texCoord) * uPattAtlas.zw);\n"
+            "    gl_FragColor.rgb = uColor.rgb;                                      \n"
 #ifdef S52_USE_AFGLOW
-            "                if (0.0 < uGlowOn) {                                    \n"
-            "                    float dist = distance(vec2(0.5,0.5), gl_PointCoord);\n"
-            "                    if (0.5 > dist) {                                   \n"
-            "                        gl_FragColor   = uColor;                        \n"
-            "                        gl_FragColor.a = v_alpha;                       \n"
-            "                    } else {                                            \n"
-            "                        discard;                                        \n"
-            "                    }                                                   \n"
-            "                } else                                                  \n"
+            "#elif defined(S52_SH_GLOW)                                              \n"
+            "    float dist = distance(vec2(0.5,0.5), gl_PointCoord);                \n"
+            "    if (0.5 > dist) {                                                   \n"
+            "        gl_FragColor   = uColor;                                        \n"
+            "        gl_FragColor.a = v_alpha;                                       \n"
+            "    } else {                                                            \n"
+            "        discard;                                                        \n"
+            "    }                                                                   \n"
 #endif
-            "                {                          \n"
-            "                    gl_FragColor = uColor; \n"
-            "                }                          \n"
-            "            }                              \n"
-            "        }                                  \n"
-            "    }                                      \n"
+            "#else                                      \n"
+            "    gl_FragColor = uColor;                 \n"
+            "#endif                                     \n"
             "}                                          \n";
 
-        _fragmentShader = _loadShader(GL_FRAGMENT_SHADER, fragSrc);
-
-
         // ----------------------------------------------------------------------
 
-        if ((0==_programObject) || (0==_vertexShader) || (0==_fragmentShader)) {
-            PRINTF("ERROR: problem loading shaders and/or creating program\n");
-            g_assert(0);
-            return FALSE;
-        }
-        _checkError("_init_es2() -0-");
-
-        if (TRUE != glIsShader(_vertexShader)) {
-            PRINTF("ERROR: glIsShader(_vertexShader) failed\n");
-            g_assert(0);
-            return FALSE;
-        }
-        if (TRUE != glIsShader(_fragmentShader)) {
-            PRINTF("ERROR: glIsShader(_fragmentShader) failed\n");
-            g_assert(0);
-            return FALSE;
-        }
-
-        _checkError("_init_es2() -1-");
-
-        glAttachShader(_programObject, _vertexShader);
-        glAttachShader(_programObject, _fragmentShader);
-        glLinkProgram (_programObject);
-        glGetProgramiv(_programObject, GL_LINK_STATUS, &linked);
-        if (GL_FALSE == linked){
-            GLsizei length;
-            GLchar  infoLog[2048];
-
-            glGetProgramInfoLog(_programObject,  2048, &length, infoLog);
-            PRINTF("problem linking program:%s", infoLog);
-
-
-            g_assert(0);
-            return FALSE;
+        for (int sh=0; sh<SH_NUM; ++sh) {
+#ifndef S52_USE_AFGLOW
+            if (SH_GLOW == sh)
+                continue;
+#endif
+            PRINTF("DEBUG: building shader variant %i\n", sh);
+            if (FALSE == _linkShader((SH)sh, vertSrc, fragSrc))
+                return FALSE;
         }
 
         _checkError("_init_es2() -2-");
 
-        //use the program
-        glUseProgram(_programObject);
+        // start with the cheapest program
+        _shCrnt = SH_NUM;
+        _glUseShader(SH_PLAIN);
+
+#ifdef S52_USE_GL3
+        _init_gl3();
+#endif
 
 
         _checkError("_init_es2() -3-");
     }
 
-
-    //load all attributes
-    //FIXME: move to bindShaderAttrib();
-    _aPosition   = glGetAttribLocation(_programObject, "aPosition");
-    _aUV         = glGetAttribLocation(_programObject, "aUV");
-    _aAlpha      = glGetAttribLocation(_programObject, "aAlpha");
-
-    //FIXME: move to bindShaderUnifrom();
-    _uProjection = glGetUniformLocation(_programObject, "uProjection");
-    _uModelview  = glGetUniformLocation(_programObject, "uModelview");
-    _uColor      = glGetUniformLocation(_programObject, "uColor");
-    _uPointSize  = glGetUniformLocation(_programObject, "uPointSize");
-    _uSampler2d  = glGetUniformLocation(_programObject, "uSampler2d");
-
-    _uBlitOn     = glGetUniformLocation(_programObject, "uBlitOn");
-    _uStipOn     = glGetUniformLocation(_programObject, "uStipOn");
-    _uGlowOn     = glGetUniformLocation(_programObject, "uGlowOn");
-
-    _uPattOn     = glGetUniformLocation(_programObject, "uPattOn");
-    _uPattGridX  = glGetUniformLocation(_programObject, "uPattGridX");
-    _uPattGridY  = glGetUniformLocation(_programObject, "uPattGridY");
-    _uPattW      = glGetUniformLocation(_programObject, "uPattW");
-    _uPattH      = glGetUniformLocation(_programObject, "uPattH");
-
-
     //  init matrix stack
     memset(_mvm, 0, sizeof(GLfloat) * 16 * MATRIX_STACK_MAX);
     memset(_pjm, 0, sizeof(GLfloat) * 16 * MATRIX_STACK_MAX);
@@ -1307,6 +1547,7 @@ static int       _set_glScaled(void)
     return TRUE;
 }
 
+#if 0
 static int       _minPOT(int value)
 // min POT greater than 'value' - simplyfie texture handling
 // compare to _nearestPOT() but use more GPU memory
@@ -1322,7 +1563,6 @@ static int       _minPOT(int value)
     }
 }
 
-#if 0
 static int       next_power_of_two(int v)
 {
     v--;
@@ -1360,45 +1600,166 @@ static guint     g_nearest_pow(gint num)
 }
 #endif
 
-static int       _renderTexure(S52_obj *obj, double tileWpx, double tileHpx, double stagOffsetPix)
+static guint      _apAtlas_hash(gconstpointer key)
 {
-    GLuint mask_texID = 0;
+    const _apKey *k = (const _apKey *)key;
 
-    glGenTextures(1, &mask_texID);
-    glBindTexture(GL_TEXTURE_2D, mask_texID);
+    guint h = g_direct_hash(k->DListData);
+    h = h*31 + (guint)(k->tileWpx       * 16.0);
+    h = h*31 + (guint)(k->tileHpx       * 16.0);
+    h = h*31 + (guint)(k->stagOffsetPix * 16.0);
+    h = h*31 + (guint) k->pen_w;
 
-    // GL_OES_texture_npot
-    // The npot extension for GLES2 is only about support of mipmaps and repeat/mirror wrap modes.
-    // If you don't care about mipmaps and use only the clamp wrap mode, you can use npot textures.
-    // It's part of the GLES2 spec.
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S,     GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T,     GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    return h;
+}
+
+static gboolean  _apAtlas_equal(gconstpointer a, gconstpointer b)
+{
+    const _apKey *ka = (const _apKey *)a;
+    const _apKey *kb = (const _apKey *)b;
+
+    return (ka->DListData     == kb->DListData     &&
+            ka->tileWpx       == kb->tileWpx       &&
+            ka->tileHpx       == kb->tileHpx       &&
+            ka->stagOffsetPix == kb->stagOffsetPix &&
+            ka->pen_w         == kb->pen_w);
+}
 
-    GLsizei w = ceil(tileWpx);
-    GLsizei h = ceil(tileHpx);
+static void      _apAtlas_freeUsers(gpointer data)
+{
+    g_slist_free((GSList *)data);
+}
 
-    if (FALSE == _GL_OES_texture_npot) {
-        w = _minPOT(w);
-        h = _minPOT(h);
+static int       _apAtlas_clear(void)
+// flush all tile - next _renderAP_gl2() re-render the tile it need
+{
+    if (NULL == _apAtlas) {
+        _apAtlas      = g_hash_table_new_full(_apAtlas_hash,  _apAtlas_equal, NULL, g_free);
+        _apAtlasUsers = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, _apAtlas_freeUsers);
+    } else {
+        // users first - list point to tile
+        g_hash_table_remove_all(_apAtlasUsers);
+        g_hash_table_remove_all(_apAtlas);
     }
 
-    if (0.0 != stagOffsetPix) {
-        w *= 2;
-        h *= 2;
+    _apAtlasShelfX = 0;
+    _apAtlasShelfY = 0;
+    _apAtlasShelfH = 0;
+
+    if (0 == _apAtlas_texID) {
+        glGenTextures(1, &_apAtlas_texID);
+        glBindTexture(GL_TEXTURE_2D, _apAtlas_texID);
+
+        // GL_REPEAT is done in the frag shader (fract()), so npot or not the atlas is POT and clamped
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S,     GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T,     GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+        // NOTE: GL_RGBA is needed for:
+        // - Vendor: Tungsten Graphics, Inc. - Renderer: Mesa DRI Intel(R) 965GM x86/MMX/SSE2
+        // - Vendor: Qualcomm                - Renderer: Adreno (TM) 320
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, S52_AP_ATLAS_SZ, S52_AP_ATLAS_SZ, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
+    _apAtlasDotpitchX = S52_MP_get(S52_MAR_DOTPITCH_MM_X);
+    _apAtlasDotpitchY = S52_MP_get(S52_MAR_DOTPITCH_MM_Y);
+
+    _checkError("_apAtlas_clear()");
+
+    return TRUE;
+}
+
+static int       _apAtlas_alloc(GLsizei w, GLsizei h, GLint *x, GLint *y)
+// shelf packing - FALSE if atlas is full
+{
+    GLsizei gw = w + 2*S52_AP_ATLAS_GUT;
+    GLsizei gh = h + 2*S52_AP_ATLAS_GUT;
+
+    if (S52_AP_ATLAS_SZ < gw || S52_AP_ATLAS_SZ < gh)
+        return FALSE;
+
+    // next shelf
+    if (S52_AP_ATLAS_SZ < _apAtlasShelfX + gw) {
+        _apAtlasShelfY += _apAtlasShelfH;
+        _apAtlasShelfX  = 0;
+        _apAtlasShelfH  = 0;
+    }
+
+    if (S52_AP_ATLAS_SZ < _apAtlasShelfY + gh)
+        return FALSE;
+
+    *x = _apAtlasShelfX + S52_AP_ATLAS_GUT;
+    *y = _apAtlasShelfY + S52_AP_ATLAS_GUT;
+
+    _apAtlasShelfX += gw;
+    _apAtlasShelfH  = MAX(_apAtlasShelfH, gh);
+
+    return TRUE;
+}
+
+static int       _apAtlas_delObj(S52_obj *obj)
+// release the tile used by this obj - tile space is reclaimed when the atlas is cleared
+{
+    if (NULL == _apAtlasUsers)
+        return TRUE;
+
+    GSList *tiles = (GSList *)g_hash_table_lookup(_apAtlasUsers, obj);
+    for (GSList *l=tiles; NULL!=l; l=l->next) {
+        _apTile *t = (_apTile *)l->data;
+        if (0 == --t->refs)
+            g_hash_table_remove(_apAtlas, &t->key);
     }
 
-    // NOTE: GL_RGBA is needed for:
-    // - Vendor: Tungsten Graphics, Inc. - Renderer: Mesa DRI Intel(R) 965GM x86/MMX/SSE2
-    // - Vendor: Qualcomm                - Renderer: Adreno (TM) 320
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, w,   h,   0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    if (NULL != tiles)
+        g_hash_table_remove(_apAtlasUsers, obj);
 
+    return TRUE;
+}
 
-    _initFBO(mask_texID);
+static int       _apAtlas_done(void)
+{
+    if (NULL != _apAtlas) {
+        g_hash_table_destroy(_apAtlasUsers);
+        _apAtlasUsers = NULL;
+        g_hash_table_destroy(_apAtlas);
+        _apAtlas      = NULL;
+    }
+
+    glDeleteTextures(1, &_apAtlas_texID);
+    _apAtlas_texID = 0;
 
-    // save texture mask ID when everythings check ok
-    S52_PL_setAPtexID(obj, mask_texID);
+    return TRUE;
+}
+
+static int       _renderTexure(S52_obj *obj, _apTile *t)
+// render pattern tile of 'obj' in its slot in the atlas
+{
+    GLint     fbo     = 0;
+    GLboolean scissor = glIsEnabled(GL_SCISSOR_TEST);
+    GLint     box[4]  = {0,0,0,0};
+    vp_t      vpSave  = _vp;
+    double    north   = _north;
+
+    // could be rendering to a tile of the tile cache
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &fbo);
+    glGetIntegerv(GL_SCISSOR_BOX, box);
+
+    _initFBO(_apAtlas_texID);
+
+    // window is the whole atlas, north up
+    _vp.x  = 0;
+    _vp.y  = 0;
+    _vp.w  = S52_AP_ATLAS_SZ;
+    _vp.h  = S52_AP_ATLAS_SZ;
+    _north = 0.0;
+    glViewport(0, 0, S52_AP_ATLAS_SZ, S52_AP_ATLAS_SZ);
+
+    // scissor box keep clear / render in the tile slot (with its gutter)
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(t->x - S52_AP_ATLAS_GUT, t->y - S52_AP_ATLAS_GUT, t->w + 2*S52_AP_ATLAS_GUT, t->h + 2*S52_AP_ATLAS_GUT);
 
     // Clear Color ------------------------------------------------
     glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
@@ -1412,8 +1773,10 @@ static int       _renderTexure(S52_obj *obj, double tileWpx, double tileHpx, dou
     glClear(GL_COLOR_BUFFER_BIT);
 #endif
 
+    glScissor(t->x, t->y, t->w, t->h);
+
     // set color alpha
-    glUniform4f(_uColor, 0.0, 0.0, 0.0, 1.0);
+    _glUniformColor(0.0, 0.0, 0.0, 1.0);
 
     _checkError("_setTexture() -1-");
 
@@ -1484,10 +1847,14 @@ static int       _renderTexure(S52_obj *obj, double tileWpx, double tileHpx, dou
     offsetpx:    0.0 x    7.6
     Tile px :   13.2 x   13.3
     */
+    double tileWpx       = t->key.tileWpx;
+    double tileHpx       = t->key.tileHpx;
+    double stagOffsetPix = t->key.stagOffsetPix;
+
     _glMatrixSet(VP_WIN);
 
 
-    _glTranslated(tileWpx/2.0 - 0.0, tileHpx/2.0 - 0.0, 0.0);
+    _glTranslated(t->x + tileWpx/2.0 - 0.0, t->y + tileHpx/2.0 - 0.0, 0.0);
     //_glTranslated(tileWpx/2.0 - 3.0, tileHpx/2.0 - 3.0, 0.0);
     //_glTranslated(tileWpx/2.0 - 5.0, tileHpx/2.0 - 5.0, 0.0);
     //_glTranslated(tileWpx/2.0 - 10.0, tileHpx/2.0 - 10.0, 0.0);
@@ -1496,27 +1863,31 @@ static int       _renderTexure(S52_obj *obj, double tileWpx, double tileHpx, dou
 
     _set_glScaled();
 
-    S52_DList *DListData = S52_PL_getDListData(obj);
-    _renderTile(DListData);
+    _renderTile(t->key.DListData);
 
     if (0.0 != stagOffsetPix) {
         _glLoadIdentity(GL_MODELVIEW);
 
-        if (TRUE == _GL_OES_texture_npot) {
-            _glTranslated(tileWpx + stagOffsetPix, tileHpx + (tileHpx/2.0), 0.0);
-        } else {
-            _glTranslated((w/2.0) + stagOffsetPix, (h/2.0), 0.0);
-        }
+        // atlas slot are not POT - so always the npot layout
+        _glTranslated(t->x + tileWpx + stagOffsetPix, t->y + tileHpx + (tileHpx/2.0), 0.0);
 
         _set_glScaled();
 
-        _renderTile(DListData);
+        _renderTile(t->key.DListData);
     }
 
     _glMatrixDel(VP_WIN);
 
+    // restore
+    _vp    = vpSave;
+    _north = north;
+    glViewport(_vp.x, _vp.y, _vp.w, _vp.h);
+    glScissor(box[0], box[1], box[2], box[3]);
+    if (GL_FALSE == scissor)
+        glDisable(GL_SCISSOR_TEST);
+
     glBindTexture(GL_TEXTURE_2D, 0);
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
 
     // debug - test to get rid of artefact at start up
     //glDeleteFramebuffers(1, &_fboID);
@@ -1524,7 +1895,75 @@ static int       _renderTexure(S52_obj *obj, double tileWpx, double tileHpx, dou
 
     _checkError("_setTexture() -1-");
 
-    return mask_texID;
+    return TRUE;
+}
+
+static _apTile  *_apAtlas_getTile(S52_obj *obj, double tileWpx, double tileHpx, double stagOffsetPix)
+// get the atlas tile of this pattern at this pixel size - render it if not in atlas
+{
+    // dotpitch change - tile of the old size are useless
+    if (NULL == _apAtlas                                        ||
+        _apAtlasDotpitchX != S52_MP_get(S52_MAR_DOTPITCH_MM_X) ||
+        _apAtlasDotpitchY != S52_MP_get(S52_MAR_DOTPITCH_MM_Y)  )
+    {
+        _apAtlas_clear();
+    }
+
+    double dummy = 0.0;
+    _apKey key;
+    memset(&key, 0, sizeof(_apKey));
+    key.DListData     = S52_PL_getDListData(obj);
+    key.tileWpx       = tileWpx;
+    key.tileHpx       = tileHpx;
+    key.stagOffsetPix = stagOffsetPix;
+    key.pen_w         = '1';
+    S52_PL_getLCdata(obj, &dummy, &key.pen_w);
+
+    _apTile *t = (_apTile *)g_hash_table_lookup(_apAtlas, &key);
+    if (NULL == t) {
+        ++_nAPAtlasMiss;
+
+        GLsizei w = ceil(tileWpx);
+        GLsizei h = ceil(tileHpx);
+        if (0.0 != stagOffsetPix) {
+            w *= 2;
+            h *= 2;
+        }
+
+        GLint x = 0;
+        GLint y = 0;
+        if (FALSE == _apAtlas_alloc(w, h, &x, &y)) {
+            // atlas full - start over
+            _apAtlas_clear();
+            if (FALSE == _apAtlas_alloc(w, h, &x, &y)) {
+                PRINTF("WARNING: AP tile too big for atlas (%i x %i)\n", w, h);
+                return NULL;
+            }
+        }
+
+        t       = g_new0(_apTile, 1);
+        t->key  = key;
+        t->x    = x;
+        t->y    = y;
+        t->w    = w;
+        t->h    = h;
+        g_hash_table_insert(_apAtlas, &t->key, t);
+
+        _renderTexure(obj, t);
+    } else {
+        ++_nAPAtlasHit;
+    }
+
+    // first time this obj use this tile
+    GSList *tiles = (GSList *)g_hash_table_lookup(_apAtlasUsers, obj);
+    if (NULL == g_slist_find(tiles, t)) {
+        ++t->refs;
+        // steal then re-insert the list, so it is not freed
+        g_hash_table_steal(_apAtlasUsers, obj);
+        g_hash_table_insert(_apAtlasUsers, obj, g_slist_prepend(tiles, t));
+    }
+
+    return t;
 }
 
 static int       _renderAP_gl2(S52_obj *obj)
@@ -1539,17 +1978,9 @@ static int       _renderAP_gl2(S52_obj *obj)
     double tileWw = tileWpx * _scalex;
     double tileHw = tileHpx * _scaley;
 
-    GLuint mask_texID = S52_PL_getAPtexID(obj);
-    if (0 == mask_texID) {
-        if (TRUE == glIsEnabled(GL_SCISSOR_TEST)) {
-            // scissor box interfere with texture creation
-            glDisable(GL_SCISSOR_TEST);
-            mask_texID = _renderTexure(obj, tileWpx, tileHpx, stagOffsetPix);
-            glEnable(GL_SCISSOR_TEST);
-        } else {
-            mask_texID = _renderTexure(obj, tileWpx, tileHpx, stagOffsetPix);
-        }
-    }
+    _apTile *t = _apAtlas_getTile(obj, tileWpx, tileHpx, stagOffsetPix);
+    if (NULL == t)
+        return FALSE;
 
     _setFragment(DListData->colors);
 
@@ -1558,25 +1989,26 @@ static int       _renderAP_gl2(S52_obj *obj)
 
     _glUniformMatrix4fv_uModelview();
 
-    glUniform1f(_uPattOn,    1.0);
+    _glUseShader(SH_PATT);
     // make no diff on MESA/gallium if it is 0.0 but not on Xoom (tegra2)
-    glUniform1f(_uPattGridX, x1);
-    glUniform1f(_uPattGridY, y1);
+    // grid relative to the GPU origin, as the vertex
+    glUniform1f(_uPattGridX, x1 - _prjOrig.u);
+    glUniform1f(_uPattGridY, y1 - _prjOrig.v);
 
     glUniform1f(_uPattW,     tileWw);        // tile width in world
     glUniform1f(_uPattH,     tileHw);        // tile height in world
 
-    glBindTexture(GL_TEXTURE_2D, mask_texID);
+    // tile in atlas (tex coord)
+    glUniform4f(_uPattAtlas, (GLfloat)t->x/S52_AP_ATLAS_SZ, (GLfloat)t->y/S52_AP_ATLAS_SZ,
+                             (GLfloat)t->w/S52_AP_ATLAS_SZ, (GLfloat)t->h/S52_AP_ATLAS_SZ);
+
+    glBindTexture(GL_TEXTURE_2D, _apAtlas_texID);
 
     _fillArea(S52_PL_getGeo(obj));
 
     glBindTexture(GL_TEXTURE_2D, 0);
 
-    glUniform1f(_uPattOn,    0.0);
-    glUniform1f(_uPattGridX, 0.0);
-    glUniform1f(_uPattGridY, 0.0);
-    glUniform1f(_uPattW,     0.0);
-    glUniform1f(_uPattH,     0.0);
+    _glUseShader(SH_PLAIN);
 
     _checkError("_renderAP_es2() -2-");
 
@@ -0,0 +1,477 @@
+// _GL3.i: definition & declaration for GL3.x, GLES3.x.
+//         Link to libGL.so or libGLESv2.so (GLES3 entry point are in libGLESv2).
+//
+// Note: GL3 extend the GL2 code path (_GL2.i), so S52_USE_GL2 (or S52_USE_GLES2) must be
+//       defined also. Define S52_USE_GLES3 for GLSL ES 3.00, else GLSL 3.30 (GL 3.3).
+// Note: the GL2 path still draw some client side array, on desktop GL this need
+//       a compatibility profile (Mesa llvmpipe: LIBGL_ALWAYS_SOFTWARE=1).
+//
+// What GL3 add to GL2:
+//  - a uniform buffer for the frame constants (projection matrix, pixel size)
+//  - a VAO per area VBO, so attribute are bound once at creation
+//  - multi-draw-indirect of the tesselated area when the driver has GL_EXT_multi_draw_indirect
+//  - instanced draw of the symbol repeated along a complex line (LC)
+//  - instanced draw of the sounding digit (SOUNDGnn / SOUNDSnn), one call per digit symbol
+//  - read pixels of dump in a ring of PBO with a fence, no pipeline stall
+
+
+// GLES3 is a superset of GLES2 - gl31.h for GL_DRAW_INDIRECT_BUFFER
+#include <GLES3/gl31.h>
+
+#ifndef S52_USE_OPENGL_VBO
+#error "GL3 need S52_USE_OPENGL_VBO"
+#endif
+
+////////////////////////////////////////////////////////
+// forward decl
+static int         _VBODrawArrays_AREA(S57_prim *);
+static int         _dumpPush(_dumpJob *job);
+////////////////////////////////////////////////////////
+
+#ifdef S52_USE_GLES3
+#define S52_GLSL_VERSION "#version 300 es\n"
+#else
+#define S52_GLSL_VERSION "#version 330 core\n"
+#endif
+
+// frame constant - uniform block 'Frame' (std140)
+#define S52_GL3_UBO_FRAME  0               // binding point
+typedef struct _frame_gl3 {
+    GLfloat pjm[16];                       // uProjection
+    GLfloat pixelSize[2];                  // uPixelSize
+    GLfloat pad[2];                        // std140 - round up to vec4
+} _frame_gl3;
+static GLuint      _frameUBO_gl3  = 0;
+
+// GL3 core need a VAO bound to draw - client array of the GL2 path go in this one
+static GLuint      _vaoDflt_gl3   = 0;
+
+// area VBO --> VAO + indirect command of each mode
+typedef struct _drawArraysIndirectCmd {
+    GLuint count;
+    GLuint instanceCount;
+    GLuint first;
+    GLuint baseInstance;                   // must be 0 on GLES
+} _drawArraysIndirectCmd;
+#define S52_GL3_MODE_NBR   3               // tesselator output: GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN
+typedef struct _vao_gl3 {
+    GLuint   vaoID;
+    GLuint   indID;                        // indirect command buffer, 0 - no MDI (draw each sub-prim)
+    GLsizei  n  [S52_GL3_MODE_NBR];        // number of command of each mode
+    GLintptr off[S52_GL3_MODE_NBR];        // offset of the first command of each mode in indID
+} _vao_gl3;
+static const GLenum _mode_gl3[S52_GL3_MODE_NBR] = {GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN};
+static GHashTable  *_vaoMap_gl3   = NULL;  // vboID --> _vao_gl3*
+
+// instancing - same symbol at many offset
+static GLint       _aInstOffset   = -1;
+static GLuint      _instVBO_gl3   = 0;
+static GArray     *_instBuf_gl3   = NULL;  // instance offset (world)
+static GLsizei     _instNbr_gl3   = 0;     // > 0 - _glCallList() draw that many instance
+
+// sounding batch - the digit symbol of SOUNDG02 are the same few DList (the 'atlas'),
+// so defer them and draw each DList once with all the sounding position as instance
+// Note: batch is filled by the DRAW cycle and flushed before any other obj / text / FB change
+static GHashTable  *_sndBatch_gl3  = NULL;  // S52_DList* --> GArray of instance offset (world)
+static GPtrArray   *_sndOrder_gl3  = NULL;  // S52_DList* in the order first seen in this batch
+
+// stat
+static guint       _nMDI_gl3      = 0;     // number of multi-draw-indirect call
+static guint       _nInst_gl3     = 0;     // number of symbol drawn by instancing
+static guint       _nSnd_gl3      = 0;     // number of sounding digit batched
+static guint       _nSndCall_gl3  = 0;     // number of instanced draw of sounding digit
+
+// async read pixels - PBO ring, a slot is busy until its fence is signaled
+#define S52_GL3_PBO_NBR    3               // triple buffered
+static GLuint      _pbo_gl3    [S52_GL3_PBO_NBR] = {0, 0, 0};
+static GLsync      _pboSync_gl3[S52_GL3_PBO_NBR] = {0, 0, 0};
+static _dumpJob   *_pboJob_gl3 [S52_GL3_PBO_NBR] = {NULL, NULL, NULL};
+static int         _pboNext_gl3   = 0;     // next slot to fill (and the oldest one)
+
+
+static const char *_glslHeader_gl3(GLenum type)
+// GLSL 1.00 source of _GL2.i compiled as GLSL 3.x
+{
+    if (GL_VERTEX_SHADER == type) {
+        return S52_GLSL_VERSION
+               "#define S52_GL3          \n"
+               "#define attribute in     \n"
+               "#define varying   out    \n";
+    }
+
+    return S52_GLSL_VERSION
+           "precision mediump float;                \n"
+           "#define S52_GL3                         \n"
+           "#define varying   in                    \n"
+           "#define texture2D texture               \n"
+           "out vec4 s52_FragColor;                 \n"
+           "#define gl_FragColor s52_FragColor      \n";
+}
+
+static void      _vaoFree_gl3(gpointer data)
+{
+    _vao_gl3 *vao = (_vao_gl3 *)data;
+
+    if (GL_TRUE == glIsVertexArray(vao->vaoID))
+        glDeleteVertexArrays(1, &vao->vaoID);
+    if (0 != vao->indID)
+        glDeleteBuffers(1, &vao->indID);
+
+    g_free(vao);
+
+    return;
+}
+
+static void      _sndFree_gl3(gpointer data)
+{
+    g_array_free((GArray *)data, TRUE);
+
+    return;
+}
+
+static int       _init_gl3(void)
+// call once the program is linked and in use
+{
+    if (GL_FALSE == glIsVertexArray(_vaoDflt_gl3))
+        glGenVertexArrays(1, &_vaoDflt_gl3);
+    glBindVertexArray(_vaoDflt_gl3);
+
+    // frame constant - same binding point in all shader variant
+    for (int sh=0; sh<SH_NUM; ++sh) {
+        GLuint prog = _shProgs[sh].prog;
+        if (0 == prog)
+            continue;
+
+        GLuint idx = glGetUniformBlockIndex(prog, "Frame");
+        if (GL_INVALID_INDEX == idx) {
+            PRINTF("ERROR: uniform block 'Frame' not found in variant %i\n", sh);
+            g_assert(0);
+            return FALSE;
+        }
+        glUniformBlockBinding(prog, idx, S52_GL3_UBO_FRAME);
+    }
+
+    if (GL_FALSE == glIsBuffer(_frameUBO_gl3)) {
+        glGenBuffers(1, &_frameUBO_gl3);
+        glBindBuffer(GL_UNIFORM_BUFFER, _frameUBO_gl3);
+        glBufferData(GL_UNIFORM_BUFFER, sizeof(_frame_gl3), NULL, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    }
+    glBindBufferBase(GL_UNIFORM_BUFFER, S52_GL3_UBO_FRAME, _frameUBO_gl3);
+
+    // instancing
+    _aInstOffset = S52_GL2_ATTRIB_INST;     // bound in _linkShader()
+    if (GL_FALSE == glIsBuffer(_instVBO_gl3))
+        glGenBuffers(1, &_instVBO_gl3);
+    if (NULL == _instBuf_gl3)
+        _instBuf_gl3 = g_array_new(FALSE, FALSE, sizeof(GLfloat)*2);
+
+    if (NULL == _sndBatch_gl3) {
+        _sndBatch_gl3 = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, _sndFree_gl3);
+        _sndOrder_gl3 = g_ptr_array_new();
+    }
+
+    if (NULL == _vaoMap_gl3)
+        _vaoMap_gl3 = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, _vaoFree_gl3);
+
+    _checkError("_init_gl3()");
+
+    return TRUE;
+}
+
+static int       _pboResolve_gl3(int wait);
+static int       _done_gl3(void)
+{
+    // flush dump in flight then free PBO
+    _pboResolve_gl3(TRUE);
+    for (int i=0; i<S52_GL3_PBO_NBR; ++i) {
+        if (0 != _pbo_gl3[i]) {
+            glDeleteBuffers(1, &_pbo_gl3[i]);
+            _pbo_gl3[i] = 0;
+        }
+    }
+
+    if (NULL != _vaoMap_gl3) {
+        g_hash_table_destroy(_vaoMap_gl3);
+        _vaoMap_gl3 = NULL;
+    }
+    if (NULL != _instBuf_gl3) {
+        g_array_free(_instBuf_gl3, TRUE);
+        _instBuf_gl3 = NULL;
+    }
+    if (NULL != _sndBatch_gl3) {
+        g_hash_table_destroy(_sndBatch_gl3);
+        g_ptr_array_free(_sndOrder_gl3, TRUE);
+        _sndBatch_gl3 = NULL;
+        _sndOrder_gl3 = NULL;
+    }
+    if (0 != _instVBO_gl3) {
+        glDeleteBuffers(1, &_instVBO_gl3);
+        _instVBO_gl3 = 0;
+    }
+    if (0 != _frameUBO_gl3) {
+        glDeleteBuffers(1, &_frameUBO_gl3);
+        _frameUBO_gl3 = 0;
+    }
+    if (0 != _vaoDflt_gl3) {
+        glBindVertexArray(0);
+        glDeleteVertexArrays(1, &_vaoDflt_gl3);
+        _vaoDflt_gl3 = 0;
+    }
+
+    return TRUE;
+}
+
+static int       _setFrameUBO_gl3(void)
+// upload frame constant - when the projection matrix change
+{
+    _frame_gl3 f;
+
+    memcpy(f.pjm, _pjm[_pjmTop], sizeof(f.pjm));
+    f.pixelSize[0] = 2.0 / _vp.w;
+    f.pixelSize[1] = 2.0 / _vp.h;
+    f.pad[0]       = 0.0;
+    f.pad[1]       = 0.0;
+
+    glBindBuffer   (GL_UNIFORM_BUFFER, _frameUBO_gl3);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(f), &f);
+    glBindBuffer   (GL_UNIFORM_BUFFER, 0);
+
+    return TRUE;
+}
+
+static _vao_gl3 *_getVAO_gl3(S57_prim *prim, guint vboID)
+// VAO of an area VBO, attribute and indirect command are set once
+{
+    _vao_gl3 *vao = (_vao_gl3 *)g_hash_table_lookup(_vaoMap_gl3, GUINT_TO_POINTER(vboID));
+    if (NULL != vao)
+        return vao;
+
+    vao = g_new0(_vao_gl3, 1);
+
+    glGenVertexArrays(1, &vao->vaoID);
+    glBindVertexArray(vao->vaoID);
+    glBindBuffer(GL_ARRAY_BUFFER, vboID);
+    glEnableVertexAttribArray(_aPosition);
+    glVertexAttribPointer(_aPosition, 3, GL_FLOAT, GL_FALSE, 0, 0);
+    glBindVertexArray(_vaoDflt_gl3);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+#ifdef GL_EXT_multi_draw_indirect
+    if (TRUE == _GL_EXT_multi_draw_indirect) {
+        // sort sub-prim by mode, one MDI call per mode
+        GArray *cmd  = g_array_new(FALSE, FALSE, sizeof(_drawArraysIndirectCmd));
+        guint   nAll = 0;
+        for (int m=0; m<S52_GL3_MODE_NBR; ++m) {
+            GLint mode  = 0;
+            GLint first = 0;
+            GLint count = 0;
+
+            vao->off[m] = cmd->len * sizeof(_drawArraysIndirectCmd);
+            for (guint i=0; TRUE==S57_getPrimIdx(prim, i, &mode, &first, &count); ++i) {
+                if (0 == m)
+                    ++nAll;
+                if ((GLenum)mode == _mode_gl3[m]) {
+                    _drawArraysIndirectCmd c = {count, 1, first, 0};
+                    g_array_append_val(cmd, c);
+                    ++vao->n[m];
+                }
+            }
+        }
+
+        // other mode (ex _TRANSLATE) - draw each sub-prim
+        if ((0 < cmd->len) && (nAll == cmd->len)) {
+            glGenBuffers(1, &vao->indID);
+            glBindBuffer(GL_DRAW_INDIRECT_BUFFER, vao->indID);
+            glBufferData(GL_DRAW_INDIRECT_BUFFER, cmd->len * sizeof(_drawArraysIndirectCmd), cmd->data, GL_STATIC_DRAW);
+            glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+        }
+
+        g_array_free(cmd, TRUE);
+    }
+#endif
+
+    g_hash_table_insert(_vaoMap_gl3, GUINT_TO_POINTER(vboID), vao);
+
+    _checkError("_getVAO_gl3()");
+
+    return vao;
+}
+
+static int       _VAODraw_gl3(S57_prim *prim, guint vboID)
+// draw an area VBO trough its VAO
+{
+    _vao_gl3 *vao = _getVAO_gl3(prim, vboID);
+
+    glBindVertexArray(vao->vaoID);
+
+#ifdef GL_EXT_multi_draw_indirect
+    if (0 != vao->indID) {
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, vao->indID);
+        for (int m=0; m<S52_GL3_MODE_NBR; ++m) {
+            if (0 < vao->n[m]) {
+                glMultiDrawArraysIndirectEXT(_mode_gl3[m], (const void *)vao->off[m], vao->n[m], 0);
+                ++_nMDI_gl3;
+            }
+        }
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    } else
+#endif
+    {
+        _VBODrawArrays_AREA(prim);
+    }
+
+    glBindVertexArray(_vaoDflt_gl3);
+
+    _checkError("_VAODraw_gl3()");
+
+    return TRUE;
+}
+
+static int       _delVAO_gl3(guint vboID)
+// VBO deleted
+{
+    if (NULL != _vaoMap_gl3)
+        g_hash_table_remove(_vaoMap_gl3, GUINT_TO_POINTER(vboID));
+
+    return TRUE;
+}
+
+static int       _instUpload_gl3(void);
+static int       _instBegin_gl3(int n, double dx, double dy)
+// next _glCallList() draw 'n' instance, instance 'i' offset by i*(dx,dy) in world
+{
+    if ((n < 1) || (-1 == _aInstOffset))
+        return FALSE;
+
+    g_array_set_size(_instBuf_gl3, 0);
+    for (int i=0; i<n; ++i) {
+        GLfloat off[2] = {i*dx, i*dy};
+        g_array_append_val(_instBuf_gl3, off);
+    }
+
+    return _instUpload_gl3();
+}
+
+static int       _instUpload_gl3(void)
+// send _instBuf_gl3 to the GPU, next _glCallList() draw that many instance
+{
+    GLsizei n = _instBuf_gl3->len;
+
+    glBindBuffer(GL_ARRAY_BUFFER, _instVBO_gl3);
+    glBufferData(GL_ARRAY_BUFFER, n * sizeof(GLfloat)*2, _instBuf_gl3->data, GL_STREAM_DRAW);
+    glEnableVertexAttribArray(_aInstOffset);
+    glVertexAttribPointer    (_aInstOffset, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glVertexAttribDivisor    (_aInstOffset, 1);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    _instNbr_gl3  = n;
+    _nInst_gl3   += n;
+
+    return TRUE;
+}
+
+static int       _instEnd_gl3(void)
+{
+    glVertexAttribDivisor    (_aInstOffset, 0);
+    glDisableVertexAttribArray(_aInstOffset);
+
+    _instNbr_gl3 = 0;
+
+    return TRUE;
+}
+
+static int       _pboMap_gl3(int i)
+// fence signaled - copy PBO to job then send it to the encoder
+{
+    _dumpJob *job = _pboJob_gl3[i];
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, _pbo_gl3[i]);
+    void *ptr = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, job->w * job->h * job->nc, GL_MAP_READ_BIT);
+    if (NULL != ptr) {
+        memcpy(job->pixels, ptr, job->w * job->h * job->nc);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        job->ret = TRUE;
+    } else {
+        PRINTF("WARNING: fail to map PBO, dump '%s' skipped\n", job->fname);
+        job->ret = FALSE;
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    glDeleteSync(_pboSync_gl3[i]);
+    _pboSync_gl3[i] = 0;
+    _pboJob_gl3 [i] = NULL;
+
+    _dumpPush(job);
+
+    _checkError("_pboMap_gl3()");
+
+    return TRUE;
+}
+
+static int       _pboResolve_gl3(int wait)
+// map PBO whose fence is signaled, oldest first - block on each if 'wait' is TRUE
+{
+    for (int n=0; n<S52_GL3_PBO_NBR; ++n) {
+        int i = (_pboNext_gl3 + n) % S52_GL3_PBO_NBR;
+
+        if (0 == _pboSync_gl3[i])
+            continue;
+
+        GLenum r = glClientWaitSync(_pboSync_gl3[i], GL_SYNC_FLUSH_COMMANDS_BIT,
+                                    (TRUE==wait) ? GL_TIMEOUT_IGNORED : 0);
+        if ((GL_ALREADY_SIGNALED==r) || (GL_CONDITION_SATISFIED==r)) {
+            _pboMap_gl3(i);
+        } else {
+            if (GL_WAIT_FAILED == r) {
+                PRINTF("WARNING: glClientWaitSync() failed\n");
+                glDeleteSync(_pboSync_gl3[i]);
+                _pboSync_gl3[i] = 0;
+                _pboJob_gl3[i]->ret = FALSE;
+                _dumpPush(_pboJob_gl3[i]);
+                _pboJob_gl3[i] = NULL;
+            }
+            // keep order - a newer one can't be signaled before this one
+            if (FALSE == wait)
+                break;
+        }
+    }
+
+    return TRUE;
+}
+
+static int       _pboRead_gl3(guint x, guint y, _dumpJob *job)
+// start async read of FB in the next PBO - job sent to the encoder when fence signaled
+{
+    int i = _pboNext_gl3;
+
+    // ring full - the oldest must land first
+    if (0 != _pboSync_gl3[i]) {
+        GLenum r = glClientWaitSync(_pboSync_gl3[i], GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+        if (GL_WAIT_FAILED == r) {
+            PRINTF("WARNING: glClientWaitSync() failed\n");
+            return FALSE;
+        }
+        _pboMap_gl3(i);
+    }
+
+    GLsizeiptr sz = job->w * job->h * job->nc;
+    if (GL_FALSE == glIsBuffer(_pbo_gl3[i]))
+        glGenBuffers(1, &_pbo_gl3[i]);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, _pbo_gl3[i]);
+    // orphan - size may change from one dump to the next
+    glBufferData(GL_PIXEL_PACK_BUFFER, sz, NULL, GL_STREAM_READ);
+
+    // RGBA/UNSIGNED_BYTE always supported, pack alignment not an issue
+    glReadPixels(x, y, job->w, job->h, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    _pboSync_gl3[i] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    _pboJob_gl3 [i] = job;
+
+    _pboNext_gl3 = (i + 1) % S52_GL3_PBO_NBR;
+
+    _checkError("_pboRead_gl3()");
+
+    return TRUE;
+}
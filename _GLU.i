@@ -25,12 +25,15 @@ typedef void (_CALLBACK *fpp)  (void*, void*);
 // tesselator for area
 static GLUtriangulatorObj *_tobj       = NULL;
 static GPtrArray          *_tmpV       = NULL;     // place holder during tesssalation (GLUtriangulatorObj combineCallback)
+static double              _tessOrig[2] = {0.0, 0.0}; // origin of the prim being tessalated (float vertex relative to it)
 
 // centroid
 static GLUtriangulatorObj *_tcen       = NULL;     // GLU CSG - Computational Solid Geometry
 static GArray             *_vertexs    = NULL;
 static GArray             *_nvertex    = NULL;     // list of nbr of vertex per poly in _vertexs
 static GArray             *_centroids  = NULL;     // centroids of poly's in _vertexs
+static GArray             *_clipA      = NULL;     // area clipped by view (convex window clip)
+static GArray             *_clipB      = NULL;
 
 // check if centroid is inside the poly
 static GLUtriangulatorObj *_tcin       = NULL;
@@ -343,9 +346,9 @@ static void_cb_t _endCin(void)
 static void_cb_t _vertex3d(GLvoid *data, S57_prim *prim)
 // double - use by the tesselator
 {
-    // cast to float after tess (double)
+    // cast to float after tess (double) - relative to origin to keep float precision
     double  *dptr = (double*)data;
-    vertex_t d[3] = {dptr[0], dptr[1], dptr[2]};
+    vertex_t d[3] = {dptr[0] - _tessOrig[0], dptr[1] - _tessOrig[1], dptr[2]};
 
     S57_addPrimVertex(prim, d);
 
@@ -458,6 +461,8 @@ static GLint     _initGLU(void)
         _centroids = g_array_new(FALSE, FALSE, sizeof(double)*3);
         _vertexs   = g_array_new(FALSE, FALSE, sizeof(double)*3);
         _nvertex   = g_array_new(FALSE, FALSE, sizeof(int));
+        _clipA     = g_array_new(FALSE, FALSE, sizeof(double)*3);
+        _clipB     = g_array_new(FALSE, FALSE, sizeof(double)*3);
 
         //gluTessProperty(_tcen, GLU_TESS_WINDING_RULE, GLU_TESS_WINDING_POSITIVE);
         //gluTessProperty(_tcen, GLU_TESS_WINDING_RULE, GLU_TESS_WINDING_NEGATIVE);
@@ -580,6 +585,10 @@ static GLint     _freeGLU(void)
     _vertexs = NULL;
     if (_nvertex)   g_array_free(_nvertex,   TRUE);
     _nvertex = NULL;
+    if (_clipA)     g_array_free(_clipA,     TRUE);
+    _clipA = NULL;
+    if (_clipB)     g_array_free(_clipB,     TRUE);
+    _clipB = NULL;
 
     return TRUE;
 }
@@ -602,6 +611,19 @@ static S57_prim *_tessd(GLUtriangulatorObj *tobj, S57_geo *geoData)
 
     _g_ptr_array_clear(_tmpV);
 
+#ifdef S52_USE_GL2
+    // vertex in float relative to the first vertex, GPU add it back (uOrigin)
+    {
+        guint     npt = 0;
+        GLdouble *ppt = NULL;
+        if (TRUE == S57_getGeoData(geoData, 0, &npt, &ppt)) {
+            _tessOrig[0] = ppt[0];
+            _tessOrig[1] = ppt[1];
+            S57_setPrimOrig(prim, ppt[0], ppt[1]);
+        }
+    }
+#endif
+
     // NOTE: _*NOT*_ NULL to trigger GL_TRIANGLES tessallation
     //gluTessCallback(_tobj, GLU_TESS_EDGE_FLAG,  (f) _edgeFlag);
 
@@ -623,6 +645,9 @@ static S57_prim *_tessd(GLUtriangulatorObj *tobj, S57_geo *geoData)
 
     //gluTessCallback(_tobj, GLU_TESS_EDGE_FLAG,  (f) NULL);
 
+    _tessOrig[0] = 0.0;
+    _tessOrig[1] = 0.0;
+
     return prim;
 }
 
@@ -668,6 +668,34 @@ static int                 _handleS52method(const gchar *str, char *result, char
         goto exit;
     }
 
+    //DLL const char * STD S52_drawTile(unsigned int z, unsigned int x, unsigned int y, const char *format);
+    if (0 == g_strcmp0(cmdName, "S52_drawTile")) {
+        if (4 != count) {
+            _setErr(err, "params 'z'/'x'/'y'/'format' not found");
+            goto exit;
+        }
+
+        double      z      = json_array_get_number(paramsArr, 0);
+        double      x      = json_array_get_number(paramsArr, 1);
+        double      y      = json_array_get_number(paramsArr, 2);
+        const char *format = json_array_get_string(paramsArr, 3);
+        if (NULL == format) {
+            _setErr(err, "params 'format' not a string");
+            goto exit;
+        }
+
+        // answer the path of the tile in the disk cache
+        const char *path = S52_drawTile((unsigned int)z, (unsigned int)x, (unsigned int)y, format);
+        if (NULL == path)
+            _encode(result, "[0]");
+        else
+            _encode(result, "[\"%s\"]", path);
+
+        //PRINTF("SOCK:S52_drawTile(): %s\n", result);
+
+        goto exit;
+    }
+
     //DLL const char * STD S52_version(void);
     if (0 == g_strcmp0(cmdName, "S52_version")) {
         const char *version = S52_version();
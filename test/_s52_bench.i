@@ -0,0 +1,176 @@
+// _s52_bench.i: soak test and benchmark of libS52 run from the test app (see s52egl.c F10-F12, c)
+//
+// Note: the libS52 side print its own stat with S52_DEBUG
+
+
+#define BENCH_SOAK_N     200000   // nbr of vessel created / deleted
+#define BENCH_SOAK_STEP   20000   // RSS report
+
+static long _s52_benchRSS(void)
+// process RSS (KB), -1 if unknown
+{
+    gchar *statm = NULL;
+    long   rss   = -1;   // page
+
+    if (TRUE == g_file_get_contents("/proc/self/statm", &statm, NULL, NULL)) {
+        sscanf(statm, "%*d %ld", &rss);
+        g_free(statm);
+    }
+
+    return (-1 == rss) ? -1 : rss * 4;   // FIXME: assume 4K page
+}
+
+static int  _s52_benchS57ID(double cLat, double cLon)
+// soak: churn AIS target, RSS must stay flat and a deleted handle must stay stale
+{
+    S52ObjectHandle stale = FALSE;
+    GTimer         *timer = g_timer_new();
+
+    LOGI("s52egl:_s52_benchS57ID(): %i vessel, RSS:%li KB\n", BENCH_SOAK_N, _s52_benchRSS());
+
+    for (int i=1; i<=BENCH_SOAK_N; ++i) {
+        S52ObjectHandle vessel = S52_newVESSEL(2, NULL);
+        if (FALSE == vessel) {
+            LOGE("s52egl:_s52_benchS57ID(): S52_newVESSEL() failed at %i\n", i);
+            break;
+        }
+        S52_pushPosition(vessel, cLat, cLon, 0.0);
+
+        if (FALSE != S52_delMarObj(vessel)) {
+            LOGE("s52egl:_s52_benchS57ID(): S52_delMarObj() failed at %i\n", i);
+            break;
+        }
+
+        if (FALSE == stale)
+            stale = vessel;
+
+        if (0 == (i % BENCH_SOAK_STEP)) {
+            // the handle of the first vessel must not alias a new vessel
+            int alias = (FALSE != S52_getMarObj(stale));
+
+            LOGI("s52egl:_s52_benchS57ID(): %7i vessel, RSS:%li KB, %.0f obj/sec, stale handle %s\n",
+                 i, _s52_benchRSS(), i / g_timer_elapsed(timer, NULL), (TRUE==alias) ? "VALID (FAIL)" : "rejected");
+        }
+    }
+
+    g_timer_destroy(timer);
+
+    return TRUE;
+}
+
+#define BENCH_DRAW_N         20   // nbr of S52_draw() timed for each setting
+
+static double _s52_benchDraw(s52engine *engine, int n)
+// time n S52_draw() - return msec per frame
+{
+    // quiet compiler - S52_USE_EGL
+    (void)engine;
+
+    GTimer *timer = g_timer_new();
+
+    for (int i=0; i<n; ++i) {
+#if !defined(S52_USE_EGL)
+        _egl_beg(engine, "bench");
+#endif
+        S52_draw();
+#if !defined(S52_USE_EGL)
+        _egl_end(engine);
+#endif
+    }
+
+    double msec = g_timer_elapsed(timer, NULL) * 1000.0 / n;
+    g_timer_destroy(timer);
+
+    return msec;
+}
+
+static int  _s52_benchCull(s52engine *engine)
+// compare the draw time with 0 (main thread) / 1 / 4 / 8 cull worker (S52_MAR_DISP_CULL_THREAD)
+// Note: only the cull is in the worker, so the gain is bounded by the cull time (see S52_DEBUG 'cull' msg)
+{
+    double nThreadList[] = {0.0, 1.0, 4.0, 8.0};
+    double nThreadUser   = S52_getMarinerParam(S52_MAR_DISP_CULL_THREAD);
+
+    // warm up - cell cache, CS
+    _s52_benchDraw(engine, 1);
+
+    for (guint i=0; i<G_N_ELEMENTS(nThreadList); ++i) {
+        S52_setMarinerParam(S52_MAR_DISP_CULL_THREAD, nThreadList[i]);
+        double msec = _s52_benchDraw(engine, BENCH_DRAW_N);
+        LOGI("s52egl:_s52_benchCull(): %.0f cull thread: %.3f msec/frame (%i frame)\n", nThreadList[i], msec, BENCH_DRAW_N);
+    }
+
+    S52_setMarinerParam(S52_MAR_DISP_CULL_THREAD, nThreadUser);
+
+    return TRUE;
+}
+
+#define BENCH_PAN_N          40   // nbr of frame of the pan / zoom loop
+
+static int  _s52_benchPan(s52engine *engine)
+// pan / zoom loop around the current view - msec/frame of the cull + draw
+// to compare obj layout: run under 'perf stat -e cache-misses,L1-dcache-load-misses'
+{
+    double cLat, cLon, rNM, north;
+    if (FALSE == S52_getView(&cLat, &cLon, &rNM, &north))
+        return FALSE;
+
+    // warm up - cell cache, CS
+    _s52_benchDraw(engine, 1);
+
+    GTimer *timer = g_timer_new();
+    for (int i=0; i<BENCH_PAN_N; ++i) {
+        // a circle of 1/4 range, zoom in / out by 50%
+        double a = (2.0 * M_PI * i) / BENCH_PAN_N;
+        double d = (rNM / 4.0) / 60.0;
+        double r = rNM * (1.0 + 0.5 * sin(a));
+
+        S52_setView(cLat + d * sin(a), cLon + d * cos(a), r, north);
+        _s52_benchDraw(engine, 1);
+    }
+    double msec = g_timer_elapsed(timer, NULL) * 1000.0 / BENCH_PAN_N;
+    g_timer_destroy(timer);
+
+    S52_setView(cLat, cLon, rNM, north);
+
+    LOGI("s52egl:_s52_benchPan(): %.3f msec/frame (%i frame)\n", msec, BENCH_PAN_N);
+
+    return TRUE;
+}
+
+#define BENCH_CS_N           10   // nbr of Safety Contour change for each setting
+
+static int  _s52_benchCS(s52engine *engine)
+// compare serial / parallel CS (S52_MAR_CS_THREAD 0 / 1 / 4 / 8): each frame change the
+// Safety Contour, so all the CS that read it are resolved again at the next S52_draw()
+{
+    double nThreadList[] = {0.0, 1.0, 4.0, 8.0};
+    double nThreadUser   = S52_getMarinerParam(S52_MAR_CS_THREAD);
+    double safety        = S52_getMarinerParam(S52_MAR_SAFETY_CONTOUR);
+
+    // warm up - cell cache, CS
+    _s52_benchDraw(engine, 1);
+
+    // draw time without CS
+    double msecDraw = _s52_benchDraw(engine, BENCH_CS_N);
+    LOGI("s52egl:_s52_benchCS(): no CS: %.3f msec/frame\n", msecDraw);
+
+    for (guint i=0; i<G_N_ELEMENTS(nThreadList); ++i) {
+        S52_setMarinerParam(S52_MAR_CS_THREAD, nThreadList[i]);
+
+        GTimer *timer = g_timer_new();
+        for (int j=0; j<BENCH_CS_N; ++j) {
+            S52_setMarinerParam(S52_MAR_SAFETY_CONTOUR, safety + ((0==(j%2)) ? 1.0 : 0.0));
+            _s52_benchDraw(engine, 1);
+        }
+        double msec = g_timer_elapsed(timer, NULL) * 1000.0 / BENCH_CS_N;
+        g_timer_destroy(timer);
+
+        LOGI("s52egl:_s52_benchCS(): %.0f CS thread: %.3f msec/frame, CS ~ %.3f msec\n", nThreadList[i], msec, msec - msecDraw);
+    }
+
+    S52_setMarinerParam(S52_MAR_SAFETY_CONTOUR, safety);
+    S52_setMarinerParam(S52_MAR_CS_THREAD,      nThreadUser);
+
+    return TRUE;
+}
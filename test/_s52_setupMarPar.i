@@ -151,6 +151,24 @@ static int      _s52_setupMarPar(void)
 
     //S52_MAR_DISP_HODATA         = 49,   // 0 - union HO data limit "m_covr"(default), 1 - all HO data limit (M_COVR+m_covr)
 
+    //S52_MAR_DISP_DECLUTTER      = 50,   // 0 - off (default), 1 - text, 2 - text + point symbol
+    //S52_setMarinerParam(S52_MAR_DISP_DECLUTTER, 1.0);
+
+    //S52_MAR_DISP_TILE_CACHE     = 51,   // 0 - off (default), N - GPU budget (MB) of the tile cache
+    //S52_setMarinerParam(S52_MAR_DISP_TILE_CACHE, 64.0);
+
+    //S52_MAR_DISP_STATE_SORT     = 52,   // 0 - off (default), 1 - sort obj by GL state inside a display priority
+    //S52_setMarinerParam(S52_MAR_DISP_STATE_SORT, 1.0);
+
+    //S52_MAR_DISP_CULL_THREAD    = 53,   // 0 - off (default), N - number of worker thread that cull the cells
+    //S52_setMarinerParam(S52_MAR_DISP_CULL_THREAD, 4.0);
+
+    //S52_MAR_DISP_DIRTY_RECT     = 54,   // 0 - off (default), 1 - drawLast() restore / redraw only the area of mariner obj that change
+    //S52_setMarinerParam(S52_MAR_DISP_DIRTY_RECT, 1.0);
+
+    //S52_MAR_CS_THREAD           = 55,   // 0 - off (default), N - number of worker thread that resolve the CS of the cells
+    //S52_setMarinerParam(S52_MAR_CS_THREAD, 4.0);
+
     //*
     // debug - use for timing rendering
     //S52_setMarinerParam(S52_CMD_WRD_FILTER, S52_CMD_WRD_FILTER_SY);
@@ -155,6 +155,7 @@ static GTimer *_timer = NULL;
 #include "_s52_setupMarPar.i"  // _s52_setupMarPar()
 #include "_s52_setupMain.i"    // _s52_setupMain(), various common test setup, LOG*(), loadCell()
 #include "_egl.i"              // _egl_init(), _egl_beg(), _egl_end(), _egl_done()
+#include "_s52_bench.i"         // _s52_benchS57ID(), _s52_benchCull(), _s52_benchPan(), _s52_benchCS()
 
 /*
 // GL not GLES2-3 When GL_EXT_framebuffer_multisample is supported, GL_EXT_framebuffer_object and GL_EXT_framebuffer_blit are also supported.
@@ -1910,6 +1911,31 @@ static int      _X11_handleXevent(gpointer user_data)
             }
 #endif
 
+            // soak - AIS target create / delete
+            if (XK_F10 == keysym) {
+                _s52_benchS57ID(engine->state.cLat, engine->state.cLon);
+                engine->do_S52draw = TRUE;
+                return TRUE;
+            }
+            // bench - draw time with 0 / 1 / 4 / 8 cull thread
+            if (XK_F11 == keysym) {
+                _s52_benchCull(engine);
+                engine->do_S52draw = TRUE;
+                return TRUE;
+            }
+            // bench - pan / zoom loop
+            if (XK_F12 == keysym) {
+                _s52_benchPan(engine);
+                engine->do_S52draw = TRUE;
+                return TRUE;
+            }
+            // bench - serial / parallel CS
+            if (XK_c == keysym) {
+                _s52_benchCS(engine);
+                engine->do_S52draw = TRUE;
+                return TRUE;
+            }
+
             // debug
             g_print("s52egl.c:keysym: 0X%X\n", keysym);
             //g_print("s52egl.c:keysym: 0X%X\n", XK_q);